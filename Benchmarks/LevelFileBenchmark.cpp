@@ -0,0 +1,81 @@
+/**
+ * @file LevelFileBenchmark.cpp
+ * @author Yeji Lee
+ *
+ * Times opening a compiled level by mapping it, against reading the
+ * same file into memory.
+ *
+ * Usage: LevelFileBenchmark [products] [repeats]
+ */
+
+#include <LevelFile.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+/// Clock used for the timings
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * run the benchmark
+ * @param argc argument count
+ * @param argv products in the level and number of repeats
+ * @return 0, or 1 if the level could not be written or opened
+ */
+int main(int argc, char** argv)
+{
+    int products = argc > 1 ? std::atoi(argv[1]) : 500000;
+    int repeats = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    // a generated level, one long conveyor
+    LevelTemplate level;
+    ItemTemplate conveyor;
+    conveyor.mKind = ItemTemplate::Kind::Conveyor;
+    conveyor.mProductCount = products;
+    level.mItems.push_back(conveyor);
+    for (int i = 0; i < products; i++)
+    {
+        ProductTemplate product;
+        product.mPlacement = i * 150;
+        product.mKick = i % 2 == 0;
+        level.mProducts.push_back(product);
+    }
+
+    auto path = std::filesystem::temp_directory_path() / "LevelFileBenchmark.level";
+    if (!LevelFile::Write(path, level.GetData()))
+    {
+        return 1;
+    }
+
+    double mapped = 0, read = 0;
+    long long placements = 0;
+    for (int r = 0; r < repeats; r++)
+    {
+        auto start = Clock::now();
+        auto file = LevelFile::Open(path);
+        if (!file)
+        {
+            return 1;
+        }
+        placements += file->GetData().mProducts[products - 1].mPlacement;
+        auto opened = Clock::now();
+
+        std::ifstream in(path, std::ios::binary);
+        std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        placements += bytes.back();
+        auto done = Clock::now();
+
+        mapped += std::chrono::duration<double>(opened - start).count();
+        read += std::chrono::duration<double>(done - opened).count();
+    }
+
+    std::filesystem::remove(path);
+
+    std::printf("level of %d products, %d repeats (checksum %lld)\n", products, repeats, placements);
+    std::printf("%-8s %12.3f ms\n", "mapped", mapped * 1000 / repeats);
+    std::printf("%-8s %12.3f ms\n", "read", read * 1000 / repeats);
+    return 0;
+}
@@ -104,9 +104,10 @@ TEST_F(BeamTest, BeamBreaking)
 
     product->SetLocation(150, 437);
 
+    mGame.AddItem(beam);
     mGame.AddItem(product);
 
-    beam->Update(0.016); // 60 fps
+    mGame.Update(0.016); // 60 fps
 
     ASSERT_TRUE(beam->IsBroken());
 }
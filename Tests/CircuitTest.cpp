@@ -0,0 +1,250 @@
+/**
+ * @file CircuitTest.cpp
+ * @author Yeji Lee
+ */
+
+#include "gtest/gtest.h"
+#include <Circuit.h>
+#include <GateLogic.h>
+#include <random>
+
+/// every value a net can hold
+const States AllStates[] = {States::One, States::Zero, States::Unknown};
+
+TEST(CircuitTest, Empty)
+{
+    Circuit circuit;
+
+    ASSERT_EQ(1, circuit.GetNetCount());
+    ASSERT_EQ(States::Unknown, circuit.GetNet(Circuit::UnconnectedNet));
+    ASSERT_FALSE(circuit.IsDirty());
+
+    circuit.Compile();
+    circuit.Evaluate();
+    ASSERT_EQ(0, circuit.GetLevelCount());
+}
+
+TEST(CircuitTest, TruthTables)
+{
+    Circuit circuit;
+    auto a = circuit.AddNet();
+    auto b = circuit.AddNet();
+    auto orOut = circuit.AddNet();
+    auto andOut = circuit.AddNet();
+    auto notOut = circuit.AddNet();
+    circuit.AddGate(GateOp::Or, a, b, orOut);
+    circuit.AddGate(GateOp::And, a, b, andOut);
+    circuit.AddGate(GateOp::Not, a, Circuit::UnconnectedNet, notOut);
+    ASSERT_TRUE(circuit.IsDirty());
+    circuit.Compile();
+    ASSERT_FALSE(circuit.IsDirty());
+
+    for (auto stateA : AllStates)
+    {
+        for (auto stateB : AllStates)
+        {
+            circuit.SetNet(a, stateA);
+            circuit.SetNet(b, stateB);
+            circuit.Evaluate();
+            ASSERT_EQ(ComputeOr(stateA, stateB), circuit.GetNet(orOut));
+            ASSERT_EQ(ComputeAnd(stateA, stateB), circuit.GetNet(andOut));
+            ASSERT_EQ(ComputeNot(stateA), circuit.GetNet(notOut));
+        }
+    }
+}
+
+TEST(CircuitTest, Levelized)
+{
+    // out = NOT((a OR b) AND c), gates added last to first
+    Circuit circuit;
+    auto a = circuit.AddNet();
+    auto b = circuit.AddNet();
+    auto c = circuit.AddNet();
+    auto orOut = circuit.AddNet();
+    auto andOut = circuit.AddNet();
+    auto out = circuit.AddNet();
+    circuit.AddGate(GateOp::Not, andOut, Circuit::UnconnectedNet, out);
+    circuit.AddGate(GateOp::And, orOut, c, andOut);
+    circuit.AddGate(GateOp::Or, a, b, orOut);
+    circuit.Compile();
+
+    ASSERT_EQ(3, circuit.GetLevelCount());
+    ASSERT_EQ(GateOp::Or, circuit.GetProgram()[0].mOp);
+    ASSERT_EQ(GateOp::And, circuit.GetProgram()[1].mOp);
+    ASSERT_EQ(GateOp::Not, circuit.GetProgram()[2].mOp);
+
+    // one evaluation is enough to settle
+    circuit.SetNet(a, States::Zero);
+    circuit.SetNet(b, States::One);
+    circuit.SetNet(c, States::One);
+    circuit.Evaluate();
+    ASSERT_EQ(States::Zero, circuit.GetNet(out));
+
+    circuit.SetNet(c, States::Zero);
+    circuit.Evaluate();
+    ASSERT_EQ(States::One, circuit.GetNet(out));
+}
+
+TEST(CircuitTest, Latches)
+{
+    Circuit circuit;
+    auto s = circuit.AddNet();
+    auto r = circuit.AddNet();
+    auto q = circuit.AddNet();
+    auto d = circuit.AddNet();
+    auto clock = circuit.AddNet();
+    auto dq = circuit.AddNet();
+    auto dqBar = circuit.AddNet();
+    circuit.AddGate(GateOp::SRLatch, s, r, q);
+    circuit.AddGate(GateOp::DLatch, d, clock, dq);
+    circuit.AddGate(GateOp::DLatchInverse, d, clock, dqBar);
+    circuit.Compile();
+
+    circuit.SetNet(s, States::One);
+    circuit.SetNet(r, States::Zero);
+    circuit.Evaluate();
+    ASSERT_EQ(States::One, circuit.GetNet(q));
+
+    // holds when neither input is set
+    circuit.SetNet(s, States::Zero);
+    circuit.Evaluate();
+    ASSERT_EQ(States::One, circuit.GetNet(q));
+
+    circuit.SetNet(r, States::One);
+    circuit.Evaluate();
+    ASSERT_EQ(States::Zero, circuit.GetNet(q));
+
+    circuit.SetNet(s, States::One);
+    circuit.Evaluate();
+    ASSERT_EQ(States::Unknown, circuit.GetNet(q));
+
+    circuit.SetNet(d, States::One);
+    circuit.SetNet(clock, States::Zero);
+    circuit.Evaluate();
+    ASSERT_EQ(States::Unknown, circuit.GetNet(dq));
+
+    circuit.SetNet(clock, States::One);
+    circuit.Evaluate();
+    ASSERT_EQ(States::One, circuit.GetNet(dq));
+    ASSERT_EQ(States::Zero, circuit.GetNet(dqBar));
+
+    circuit.SetNet(clock, States::Zero);
+    circuit.SetNet(d, States::Zero);
+    circuit.Evaluate();
+    ASSERT_EQ(States::One, circuit.GetNet(dq));
+    ASSERT_EQ(States::Zero, circuit.GetNet(dqBar));
+
+    // Q' is One, not the inverse of Q, when an Unknown D is clocked in
+    circuit.SetNet(d, States::Unknown);
+    circuit.SetNet(clock, States::One);
+    circuit.Evaluate();
+    ASSERT_EQ(States::Unknown, circuit.GetNet(dq));
+    ASSERT_EQ(States::One, circuit.GetNet(dqBar));
+}
+
+TEST(CircuitTest, FeedbackLoop)
+{
+    // cross-coupled gates cannot be levelized but still compile
+    Circuit circuit;
+    auto a = circuit.AddNet();
+    auto x = circuit.AddNet();
+    auto y = circuit.AddNet();
+    circuit.AddGate(GateOp::Or, a, y, x);
+    circuit.AddGate(GateOp::Not, x, Circuit::UnconnectedNet, y);
+    circuit.Compile();
+
+    ASSERT_EQ(2, circuit.GetProgram().size());
+    ASSERT_EQ(GateOp::Or, circuit.GetProgram()[0].mOp);
+
+    // an Unknown anywhere in the loop stays Unknown
+    circuit.SetNet(a, States::One);
+    circuit.Evaluate();
+    ASSERT_EQ(States::Unknown, circuit.GetNet(x));
+    ASSERT_EQ(States::Unknown, circuit.GetNet(y));
+}
+
+TEST(CircuitTest, PropagateOnlyRunsChanges)
+{
+    // two independent chains: x -> NOT -> NOT, y -> NOT -> NOT -> NOT
+    Circuit circuit;
+    auto x = circuit.AddNet();
+    auto y = circuit.AddNet();
+    uint32_t xOut = x;
+    uint32_t yOut = y;
+    for (int i = 0; i < 2; i++)
+    {
+        auto net = circuit.AddNet();
+        circuit.AddGate(GateOp::Not, xOut, Circuit::UnconnectedNet, net);
+        xOut = net;
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        auto net = circuit.AddNet();
+        circuit.AddGate(GateOp::Not, yOut, Circuit::UnconnectedNet, net);
+        yOut = net;
+    }
+    circuit.Compile();
+
+    // everything runs once after compiling
+    ASSERT_FALSE(circuit.IsIdle());
+    ASSERT_EQ(5, circuit.Propagate());
+    ASSERT_TRUE(circuit.IsIdle());
+
+    // nothing changed, nothing runs
+    ASSERT_EQ(0, circuit.Propagate());
+    circuit.SetNet(x, States::Unknown);
+    ASSERT_EQ(0, circuit.Propagate());
+
+    circuit.SetNet(x, States::One);
+    ASSERT_EQ(2, circuit.Propagate());
+    ASSERT_EQ(States::One, circuit.GetNet(xOut));
+    ASSERT_EQ(2, circuit.GetChangedNets().size());
+    ASSERT_EQ(States::Unknown, circuit.GetNet(yOut));
+
+    circuit.SetNet(y, States::Zero);
+    ASSERT_EQ(3, circuit.Propagate());
+    ASSERT_EQ(States::One, circuit.GetNet(yOut));
+    ASSERT_EQ(0, circuit.Propagate());
+}
+
+TEST(CircuitTest, PropagateMatchesEvaluate)
+{
+    // a random circuit with latches and loops, driven by random inputs
+    std::mt19937 random(335);
+    const int inputs = 6;
+    const int gates = 60;
+    const GateOp ops[] = {GateOp::Or, GateOp::And, GateOp::Not, GateOp::SRLatch, GateOp::DLatch,
+                          GateOp::DLatchInverse};
+
+    Circuit evaluated;
+    for (int i = 0; i < inputs + gates; i++)
+    {
+        evaluated.AddNet();
+    }
+    for (int i = 0; i < gates; i++)
+    {
+        auto pick = [&random]() { return uint32_t(random() % (inputs + gates) + 1); };
+        evaluated.AddGate(ops[random() % 6], pick(), pick(), uint32_t(inputs + i + 1));
+    }
+    evaluated.Compile();
+    Circuit propagated = evaluated;
+
+    for (int step = 0; step < 200; step++)
+    {
+        // change a couple of inputs each step
+        for (int i = 0; i < 2; i++)
+        {
+            auto net = uint32_t(random() % inputs + 1);
+            auto state = AllStates[random() % 3];
+            evaluated.SetNet(net, state);
+            propagated.SetNet(net, state);
+        }
+
+        evaluated.Evaluate();
+        propagated.Propagate();
+        for (uint32_t net = 0; net < evaluated.GetNetCount(); net++)
+        {
+            ASSERT_EQ(evaluated.GetNet(net), propagated.GetNet(net)) << "step " << step << " net " << net;
+        }
+    }
+}
@@ -0,0 +1,45 @@
+/**
+ * @file DamageRegionTest.cpp
+ * @author Yeji Lee
+ */
+
+#include "gtest/gtest.h"
+#include <DamageRegion.h>
+
+typedef DamageRegion::Rect Rect;
+
+TEST(DamageRegionTest, MergesTouching)
+{
+    DamageRegion damage;
+    ASSERT_TRUE(damage.IsEmpty());
+
+    damage.Add({0, 0, 10, 10});
+    damage.Add({100, 100, 110, 110});
+    damage.Add({5, 5, 20, 20});
+    damage.Add({0, 0, 0, 50});
+    ASSERT_EQ(2u, damage.GetRects().size());
+
+    // bridges the two, so all three become one
+    damage.Add({15, 15, 105, 105});
+    ASSERT_EQ(1u, damage.GetRects().size());
+    ASSERT_TRUE(damage.GetRects()[0] == Rect({0, 0, 110, 110}));
+
+    damage.Clear();
+    ASSERT_TRUE(damage.IsEmpty());
+}
+
+TEST(DamageRegionTest, CollapsesAndEverything)
+{
+    DamageRegion damage;
+    for (size_t i = 0; i <= DamageRegion::MaxRects; i++)
+    {
+        damage.Add({i * 100.0, 0, i * 100.0 + 10, 10});
+    }
+    ASSERT_EQ(1u, damage.GetRects().size());
+    ASSERT_TRUE(damage.GetRects()[0] == Rect({0, 0, DamageRegion::MaxRects * 100.0 + 10, 10}));
+
+    damage.Add(DamageRegion::Everything);
+    ASSERT_TRUE(damage.IsAll());
+    ASSERT_FALSE(damage.IsEmpty());
+    ASSERT_TRUE(damage.GetRects().empty());
+}
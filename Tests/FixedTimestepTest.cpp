@@ -0,0 +1,85 @@
+/**
+ * @file FixedTimestepTest.cpp
+ * @author Yeji Lee
+ */
+
+#include "gtest/gtest.h"
+#include <FixedTimestep.h>
+#include <Simulation.h>
+
+TEST(FixedTimestepTest, WholeTicks)
+{
+    FixedTimestep timestep;
+
+    ASSERT_EQ(0, timestep.Advance(FixedTimestep::TickDuration * 0.5));
+    ASSERT_EQ(1, timestep.Advance(FixedTimestep::TickDuration * 0.6));
+    ASSERT_NEAR(0.1, timestep.GetAlpha(), 0.0001);
+
+    int ticks = 0;
+    for (int i = 0; i < 5; i++)
+    {
+        ticks += timestep.Advance(0.2);
+    }
+    ASSERT_EQ(TicksPerSecond, ticks);
+    ASSERT_EQ(TicksPerSecond + 1, timestep.GetTicks());
+}
+
+TEST(FixedTimestepTest, DropsBacklog)
+{
+    FixedTimestep timestep;
+
+    ASSERT_EQ(MaxTicksPerFrame, timestep.Advance(10));
+    ASSERT_EQ(0, timestep.Advance(0));
+    ASSERT_EQ(MaxTicksPerFrame, timestep.GetTicks());
+
+    timestep.Reset();
+    ASSERT_EQ(0, timestep.GetTicks());
+    ASSERT_EQ(0, timestep.GetAlpha());
+}
+
+/**
+ * run a level of one conveyor and product with the given frame times
+ * @param frames frame times in seconds
+ * @return final y of the product
+ */
+static double RunFrames(const std::vector<double>& frames)
+{
+    Simulation simulation;
+    FixedTimestep timestep;
+
+    auto conveyor = std::make_shared<ConveyorModel>(205, 400, 100, 800);
+    auto product = std::make_shared<ProductModel>(100, ProductModel::Properties::Square,
+                                                  ProductModel::Properties::Red,
+                                                  ProductModel::Properties::None, false);
+    product->SetConveyor(conveyor.get());
+    product->SetLocation(205, 300);
+    simulation.AddConveyor(conveyor);
+    simulation.AddProduct(product);
+    simulation.StartConveyor(conveyor.get());
+
+    for (auto frame : frames)
+    {
+        int ticks = timestep.Advance(frame);
+        for (int i = 0; i < ticks; i++)
+        {
+            simulation.Update(FixedTimestep::TickDuration);
+        }
+    }
+
+    return product->GetY();
+}
+
+TEST(FixedTimestepTest, SameTicksSameResult)
+{
+    // just over a second as steady frames and as jittery ones
+    const double frame = 1.002 / 60;
+    std::vector<double> steady(60, frame);
+    std::vector<double> jittery;
+    for (int i = 0; i < 30; i++)
+    {
+        jittery.push_back(frame * 0.5);
+        jittery.push_back(frame * 1.5);
+    }
+
+    ASSERT_EQ(RunFrames(steady), RunFrames(jittery));
+}
@@ -0,0 +1,54 @@
+/**
+ * @file FrameProfilerTest.cpp
+ * @author Yeji Lee
+ */
+
+#include "gtest/gtest.h"
+#include <FrameProfiler.h>
+
+typedef FrameProfiler::Phase Phase;
+
+TEST(FrameProfilerTest, Disabled)
+{
+    FrameProfiler profiler;
+    {
+        ScopedTimer timer(profiler, Phase::Update);
+    }
+    profiler.EndFrame();
+    ASSERT_EQ(profiler.GetFrameCount(), 0u);
+    ASSERT_EQ(profiler.GetPercentile(Phase::Update, 50), 0);
+}
+
+TEST(FrameProfilerTest, Percentiles)
+{
+    FrameProfiler profiler;
+    profiler.SetEnabled(true);
+
+    // more frames than are kept, so the first ones are dropped
+    for (int frame = 1; frame <= int(FrameProfiler::Frames) + 100; frame++)
+    {
+        profiler.Add(Phase::DrawItems, frame * 0.001);
+        profiler.Add(Phase::DrawItems, frame * 0.001);
+        profiler.EndFrame();
+    }
+    ASSERT_EQ(profiler.GetFrameCount(), FrameProfiler::Frames);
+
+    // frames 101 to 356, each the sum of its two additions
+    ASSERT_NEAR(profiler.GetPercentile(Phase::DrawItems, 0), 0.202, 1e-6);
+    ASSERT_NEAR(profiler.GetPercentile(Phase::DrawItems, 50), 0.458, 1e-6);
+    ASSERT_NEAR(profiler.GetPercentile(Phase::DrawItems, 100), 0.712, 1e-6);
+    ASSERT_NEAR(profiler.GetMean(Phase::DrawItems), 0.457, 1e-6);
+    ASSERT_EQ(profiler.GetPercentile(Phase::DrawWires, 99), 0);
+
+    {
+        ScopedTimer timer(profiler, Phase::Circuit);
+    }
+    profiler.EndFrame();
+    ASSERT_GE(profiler.GetPercentile(Phase::Circuit, 100), 0);
+    ASSERT_GT(profiler.GetPercentile(Phase::Interval, 100), 0);
+
+    // turning it on again starts from nothing
+    profiler.SetEnabled(false);
+    profiler.SetEnabled(true);
+    ASSERT_EQ(profiler.GetFrameCount(), 0u);
+}
@@ -6,6 +6,11 @@
 #include <pch.h>
 #include "gtest/gtest.h"
 #include <Game.h>
+#include <Gate.h>
+#include <Sensor.h>
+#include <Sparty.h>
+#include <Product.h>
+#include <PinPool.h>
 
 using namespace std;
 
@@ -33,3 +38,66 @@ TEST(GameTest, LoadLevel1) {
     ASSERT_EQ(game.GetItemSize(), 3) << L"Scoreboard, Beam and Conveyor are loaded";
 }
 
+
+TEST(GameTest, Registry) {
+    Game game;
+
+    wxString level = L"levels/level1.xml";
+
+    game.Load(level);
+
+    const auto& registry = game.GetRegistry();
+    ASSERT_EQ(registry.GetConveyors().size(), 1);
+    ASSERT_EQ(registry.GetProducts().size(), 4);
+    ASSERT_EQ(registry.GetBeams().size(), 1);
+    ASSERT_EQ(registry.GetSpartys().size(), 1);
+    ASSERT_TRUE(registry.GetGates().empty());
+
+    game.Clear();
+
+    ASSERT_TRUE(registry.GetConveyors().empty());
+    ASSERT_TRUE(registry.GetProducts().empty());
+    ASSERT_TRUE(registry.GetBeams().empty());
+    ASSERT_TRUE(registry.GetSpartys().empty());
+}
+
+TEST(GameTest, CircuitSortsProducts) {
+    Game game;
+
+    wxString level = L"levels/level2.xml";
+
+    game.Load(level);
+
+    // nothing is wired to Sparty yet
+    ASSERT_FALSE(game.CircuitSortsProducts());
+
+    const auto& registry = game.GetRegistry();
+    auto red = registry.GetSensors().front()->GetPropertyPins().front().first;
+    auto sparty = registry.GetSpartys().front()->GetInputPin();
+
+    // red AND an unconnected input is Unknown, which never kicks
+    auto andGate = std::make_shared<ANDGate>(&game);
+    game.AddGate(andGate);
+    auto& pins = game.GetPins();
+    auto andOutput = pins.Get(andGate->GetOutputPins()[0]);
+    game.AddWire(red, pins.Get(andGate->GetInputPins()[0]));
+    game.AddWire(andOutput, sparty);
+    ASSERT_FALSE(game.CircuitSortsProducts());
+
+    red->SetCurrentState(States::One);
+    game.ComputeGateOutputs();
+    ASSERT_EQ(States::Unknown, sparty->GetCurrentState());
+
+    // the red sensor straight to Sparty sorts the level
+    game.RemoveWire(andOutput, sparty);
+    game.AddWire(red, sparty);
+    ASSERT_TRUE(game.CircuitSortsProducts());
+
+    // and the live circuit agrees, with each product in front of the sensor
+    for (auto product : registry.GetProducts())
+    {
+        red->SetCurrentState(product->GetColor() == Product::Properties::Red ? States::One : States::Zero);
+        game.ComputeGateOutputs();
+        ASSERT_EQ(product->ShouldKick(), sparty->GetCurrentState() == States::One);
+    }
+}
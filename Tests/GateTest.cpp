@@ -5,20 +5,23 @@
 #include <pch.h>
 #include "gtest/gtest.h"
 #include <Gate.h>
+#include <Game.h>
 
 using namespace std;
 
 
 TEST(GateTest, OrGateConstruct)
 {
- ORGate orGate;
+ Game game;
+ ORGate orGate(&game);
  EXPECT_EQ(orGate.ComputeOutput(), States::Unknown) << "ORGate should initialize with Unknown state inputs.";
 
 }
 
 TEST(GateTest, ANDGateConstruct)
 {
- ANDGate andGate;
+ Game game;
+ ANDGate andGate(&game);
 
  EXPECT_EQ(andGate.ComputeOutput(), States::Unknown) << "ANDGate should initialize with Unknown state inputs.";
 }
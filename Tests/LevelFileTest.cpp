@@ -0,0 +1,118 @@
+/**
+ * @file LevelFileTest.cpp
+ * @author Yeji Lee
+ */
+
+#include "gtest/gtest.h"
+#include <LevelFile.h>
+#include <cstddef>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+/**
+ * a level with a sensor and a conveyor of products
+ * @param products number of products on the conveyor
+ * @return the level
+ */
+static LevelTemplate MakeLevel(int products)
+{
+    LevelTemplate level;
+    level.mWidth = 1150;
+    level.mHeight = 800;
+
+    ItemTemplate sensor;
+    sensor.mKind = ItemTemplate::Kind::Sensor;
+    sensor.mX = 155;
+    level.SetText(sensor, "red green blue ");
+    level.mItems.push_back(sensor);
+
+    ItemTemplate conveyor;
+    conveyor.mKind = ItemTemplate::Kind::Conveyor;
+    conveyor.mSpeed = 100;
+    conveyor.mProductCount = products;
+    level.mItems.push_back(conveyor);
+
+    for (int i = 0; i < products; i++)
+    {
+        ProductTemplate product;
+        product.mPlacement = 100 + i * 150;
+        product.mKick = i % 2 == 0;
+        level.mProducts.push_back(product);
+    }
+
+    return level;
+}
+
+TEST(LevelFileTest, RoundTrip)
+{
+    auto path = fs::temp_directory_path() / "LevelFileTest.level";
+    auto level = MakeLevel(1000);
+    ASSERT_TRUE(LevelFile::Write(path, level.GetData()));
+
+    auto file = LevelFile::Open(path);
+    ASSERT_NE(nullptr, file);
+    auto data = file->GetData();
+    ASSERT_EQ(1150, data.mWidth);
+    ASSERT_EQ(800, data.mHeight);
+    ASSERT_EQ(2, data.mItemCount);
+    ASSERT_EQ(1000, data.mProductCount);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data.mItems) % alignof(ItemTemplate));
+
+    ASSERT_EQ(ItemTemplate::Kind::Sensor, data.mItems[0].mKind);
+    ASSERT_EQ("red green blue ", data.GetText(data.mItems[0]));
+    ASSERT_EQ(100, data.mItems[1].mSpeed);
+    ASSERT_EQ(100 + 999 * 150, data.mProducts[999].mPlacement);
+    ASSERT_FALSE(data.mProducts[999].mKick);
+
+    file.reset();
+    fs::remove(path);
+}
+
+TEST(LevelFileTest, RejectsBadFiles)
+{
+    auto path = fs::temp_directory_path() / "LevelFileBad.level";
+    ASSERT_EQ(nullptr, LevelFile::Open(path));
+
+    std::ofstream(path) << "<level size=\"1150,800\"></level>";
+    ASSERT_EQ(nullptr, LevelFile::Open(path));
+
+    // products past the end of the file
+    auto level = MakeLevel(10);
+    ASSERT_TRUE(LevelFile::Write(path, level.GetData()));
+    fs::resize_file(path, fs::file_size(path) - 60);
+    ASSERT_EQ(nullptr, LevelFile::Open(path));
+
+    // a conveyor claiming more products than the level has
+    level.mItems[1].mProductCount = 11;
+    ASSERT_TRUE(LevelFile::Write(path, level.GetData()));
+    ASSERT_EQ(nullptr, LevelFile::Open(path));
+    level.mItems[1].mProductCount = 10;
+
+    // a product whose color is a shape, or content too big for its bits
+    level.mProducts[3].mColor = ProductModel::Properties::Circle;
+    ASSERT_TRUE(LevelFile::Write(path, level.GetData()));
+    ASSERT_EQ(nullptr, LevelFile::Open(path));
+    level.mProducts[3].mColor = ProductModel::Properties::Red;
+    level.mProducts[3].mContent = ProductModel::Properties(40);
+    ASSERT_TRUE(LevelFile::Write(path, level.GetData()));
+    ASSERT_EQ(nullptr, LevelFile::Open(path));
+    level.mProducts[3].mContent = ProductModel::Properties::None;
+
+    // a kick byte that is neither false nor true
+    ASSERT_TRUE(LevelFile::Write(path, level.GetData()));
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        LevelFileHeader header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        file.seekp(header.mProductOffset + 3 * sizeof(ProductTemplate) + offsetof(ProductTemplate, mKick));
+        file.put(2);
+    }
+    ASSERT_EQ(nullptr, LevelFile::Open(path));
+
+    // the same file with the products intact still opens
+    ASSERT_TRUE(LevelFile::Write(path, level.GetData()));
+    ASSERT_NE(nullptr, LevelFile::Open(path));
+
+    fs::remove(path);
+}
@@ -0,0 +1,109 @@
+/**
+ * @file LevelReaderTest.cpp
+ * @author Yeji Lee
+ */
+
+#include "gtest/gtest.h"
+#include <LevelReader.h>
+#include <sstream>
+
+/// A level using every item and the attribute forms the levels use
+static const char* Level = R"(<?xml version='1.0' encoding='UTF-8'?>
+<!-- a test level -->
+<level size="1150,800">
+	<items>
+		<sensor x="155" y="155" p="10,20">
+			<red/>
+			<izzo/>
+		</sensor>
+		<conveyor x="150" y="400" speed="100" height="800" panel="60,-390">
+			<product placement="100" shape="circle" color="blue" content="smith" kick="yes"/>
+			<product placement="+150"/>
+			<product placement="+150" shape="diamond" color="green"></product>
+		</conveyor>
+		<beam x="242" y="437" sender="-185" />
+		<sparty x="290" y="340" height="300" pin="1100, 400" kick-duration="0.25" kick-speed="1000"/>
+		<scoreboard x="700" y="40">Kick &amp; score<br/>Connect &#x41;</scoreboard>
+	</items>
+</level>
+)";
+
+TEST(LevelReaderTest, Read)
+{
+    std::istringstream in(Level);
+    auto level = LevelReader::Read(in);
+    ASSERT_NE(level, nullptr);
+
+    auto data = level->GetData();
+    ASSERT_EQ(data.mItemCount, 5u);
+    ASSERT_EQ(data.mProductCount, 3u);
+    ASSERT_EQ(data.mWidth, 1150);
+    ASSERT_EQ(data.mHeight, 800);
+
+    const auto& sensor = data.mItems[0];
+    ASSERT_EQ(sensor.mKind, ItemTemplate::Kind::Sensor);
+    ASSERT_DOUBLE_EQ(sensor.mPositionX, 10);
+    ASSERT_DOUBLE_EQ(sensor.mPositionY, 20);
+    ASSERT_EQ(data.GetText(sensor), "red izzo ");
+
+    const auto& conveyor = data.mItems[1];
+    ASSERT_EQ(conveyor.mKind, ItemTemplate::Kind::Conveyor);
+    ASSERT_DOUBLE_EQ(conveyor.mSpeed, 100);
+    ASSERT_DOUBLE_EQ(conveyor.mPanelY, -390);
+    ASSERT_EQ(conveyor.mFirstProduct, 0u);
+    ASSERT_EQ(conveyor.mProductCount, 3u);
+
+    // relative placements, and the defaults of a product with no attributes
+    ASSERT_EQ(data.mProducts[0].mShape, ProductModel::Properties::Circle);
+    ASSERT_TRUE(data.mProducts[0].mKick);
+    ASSERT_EQ(data.mProducts[1].mPlacement, 250);
+    ASSERT_EQ(data.mProducts[1].mShape, ProductModel::Properties::Square);
+    ASSERT_EQ(data.mProducts[1].mColor, ProductModel::Properties::Red);
+    ASSERT_EQ(data.mProducts[1].mContent, ProductModel::Properties::None);
+    ASSERT_FALSE(data.mProducts[1].mKick);
+    ASSERT_EQ(data.mProducts[2].mPlacement, 400);
+    ASSERT_EQ(data.mProducts[2].mColor, ProductModel::Properties::Green);
+
+    ASSERT_EQ(data.mItems[2].mKind, ItemTemplate::Kind::Beam);
+    ASSERT_EQ(data.mItems[2].mSender, -185);
+
+    const auto& sparty = data.mItems[3];
+    ASSERT_EQ(sparty.mKind, ItemTemplate::Kind::Sparty);
+    ASSERT_DOUBLE_EQ(sparty.mKickDuration, 0.25);
+    ASSERT_DOUBLE_EQ(sparty.mPinX, 1100);
+    ASSERT_DOUBLE_EQ(sparty.mPinY, 400);
+
+    ASSERT_EQ(data.GetText(data.mItems[4]), "Kick & score\nConnect A");
+}
+
+TEST(LevelReaderTest, Malformed)
+{
+    for (auto text : {"", "<level>", "<level><items></level", "<level a=1/>", "<level>&bogus;</level>",
+                      "<level size=\"1150,800\"><items><beam x=\"297\" y=\"437\"></sensor></items></level>",
+                      "<level size=\"1150,800\"><items></items></bogus>"})
+    {
+        std::istringstream in(text);
+        ASSERT_EQ(LevelReader::Read(in), nullptr) << text;
+    }
+
+    ASSERT_EQ(LevelReader::Read(std::filesystem::path("no/such/level.xml")), nullptr);
+}
+
+TEST(LevelReaderTest, Large)
+{
+    // many times the parser's buffer, so elements cross refills
+    const int products = 100000;
+    std::string text = "<level size=\"1150,800\"><items><conveyor speed=\"100\">";
+    for (int i = 0; i < products; i++)
+    {
+        text += "<product placement=\"+150\" color=\"blue\"/>\n";
+    }
+    text += "</conveyor></items></level>";
+
+    std::istringstream in(text);
+    auto level = LevelReader::Read(in);
+    ASSERT_NE(level, nullptr);
+    ASSERT_EQ(level->mProducts.size(), size_t(products));
+    ASSERT_EQ(level->mProducts.back().mPlacement, products * 150);
+    ASSERT_EQ(level->mProducts.back().mColor, ProductModel::Properties::Blue);
+}
@@ -0,0 +1,45 @@
+/**
+ * @file LevelTemplateCacheTest.cpp
+ * @author Yeji Lee
+ */
+
+#include "gtest/gtest.h"
+#include <LevelTemplateCache.h>
+#include <chrono>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+TEST(LevelTemplateCacheTest, FindsStoredLevel)
+{
+    auto path = fs::temp_directory_path() / "LevelTemplateCacheTest.xml";
+    std::ofstream(path) << "<level/>";
+
+    LevelTemplateCache cache;
+    ASSERT_EQ(nullptr, cache.Find(path));
+
+    auto level = std::make_shared<LevelTemplate>();
+    level->mWidth = 1150;
+    cache.Store(path, level);
+    ASSERT_EQ(1, cache.size());
+    ASSERT_EQ(level, cache.Find(path));
+
+    fs::remove(path);
+}
+
+TEST(LevelTemplateCacheTest, ModifiedFileMisses)
+{
+    auto path = fs::temp_directory_path() / "LevelTemplateCacheModified.xml";
+    std::ofstream(path) << "<level/>";
+
+    LevelTemplateCache cache;
+    cache.Store(path, std::make_shared<LevelTemplate>());
+    ASSERT_NE(nullptr, cache.Find(path));
+
+    fs::last_write_time(path, fs::last_write_time(path) + std::chrono::seconds(5));
+    ASSERT_EQ(nullptr, cache.Find(path));
+
+    // a file that is gone is not found either
+    fs::remove(path);
+    ASSERT_EQ(nullptr, cache.Find(path));
+}
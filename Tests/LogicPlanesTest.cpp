@@ -0,0 +1,158 @@
+/**
+ * @file LogicPlanesTest.cpp
+ * @author Yeji Lee
+ */
+
+#include "gtest/gtest.h"
+#include <LogicPlanes.h>
+#include <Circuit.h>
+#include <GateLogic.h>
+#include <random>
+
+/// every value a net can hold
+static const States PlaneStates[] = {States::One, States::Zero, States::Unknown};
+
+TEST(LogicPlanesTest, SetGet)
+{
+    LogicPlanes planes(2, 130);
+    ASSERT_EQ(3, planes.GetWords());
+    ASSERT_EQ(States::Unknown, planes.Get(1, 129));
+
+    planes.Set(1, 129, States::One);
+    planes.Set(1, 64, States::Zero);
+    ASSERT_EQ(States::One, planes.Get(1, 129));
+    ASSERT_EQ(States::Zero, planes.Get(1, 64));
+    ASSERT_EQ(States::Unknown, planes.Get(0, 129));
+
+    planes.Set(1, 129, States::Unknown);
+    ASSERT_EQ(States::Unknown, planes.Get(1, 129));
+
+    planes.Fill(States::One);
+    ASSERT_EQ(States::One, planes.Get(0, 0));
+}
+
+TEST(LogicPlanesTest, KernelsMatchGateLogic)
+{
+    // every pair of inputs, repeated so the vector and leftover paths both run
+    const size_t scenarios = 9 * 41;
+    LogicPlanes planes(5, scenarios);
+    for (size_t s = 0; s < scenarios; s++)
+    {
+        planes.Set(0, s, PlaneStates[s % 3]);
+        planes.Set(1, s, PlaneStates[s / 3 % 3]);
+    }
+
+    size_t words = planes.GetWords();
+    PlaneOr(planes.Known(0), planes.Value(0), planes.Known(1), planes.Value(1),
+            planes.Known(2), planes.Value(2), words);
+    PlaneAnd(planes.Known(0), planes.Value(0), planes.Known(1), planes.Value(1),
+             planes.Known(3), planes.Value(3), words);
+    PlaneNot(planes.Known(0), planes.Value(0), planes.Known(4), planes.Value(4), words);
+
+    for (size_t s = 0; s < scenarios; s++)
+    {
+        States a = PlaneStates[s % 3];
+        States b = PlaneStates[s / 3 % 3];
+        ASSERT_EQ(ComputeOr(a, b), planes.Get(2, s)) << PlaneKernelName();
+        ASSERT_EQ(ComputeAnd(a, b), planes.Get(3, s)) << PlaneKernelName();
+        ASSERT_EQ(ComputeNot(a), planes.Get(4, s)) << PlaneKernelName();
+    }
+}
+
+TEST(LogicPlanesTest, KernelsMatchScalar)
+{
+    const size_t words = 11;
+    std::mt19937_64 random(335);
+    std::vector<uint64_t> in[4];
+    for (auto& plane : in)
+    {
+        for (size_t i = 0; i < words; i++)
+        {
+            plane.push_back(random());
+        }
+    }
+    // keep the inputs canonical, Unknown has a zero value bit
+    for (size_t i = 0; i < words; i++)
+    {
+        in[1][i] &= in[0][i];
+        in[3][i] &= in[2][i];
+    }
+
+    std::vector<uint64_t> known(words), value(words), knownScalar(words), valueScalar(words);
+
+    PlaneOr(in[0].data(), in[1].data(), in[2].data(), in[3].data(), known.data(), value.data(), words);
+    PlaneOrScalar(in[0].data(), in[1].data(), in[2].data(), in[3].data(), knownScalar.data(), valueScalar.data(), words);
+    ASSERT_EQ(knownScalar, known);
+    ASSERT_EQ(valueScalar, value);
+
+    PlaneAnd(in[0].data(), in[1].data(), in[2].data(), in[3].data(), known.data(), value.data(), words);
+    PlaneAndScalar(in[0].data(), in[1].data(), in[2].data(), in[3].data(), knownScalar.data(), valueScalar.data(), words);
+    ASSERT_EQ(knownScalar, known);
+    ASSERT_EQ(valueScalar, value);
+
+    PlaneNot(in[0].data(), in[1].data(), known.data(), value.data(), words);
+    PlaneNotScalar(in[0].data(), in[1].data(), knownScalar.data(), valueScalar.data(), words);
+    ASSERT_EQ(knownScalar, known);
+    ASSERT_EQ(valueScalar, value);
+}
+
+TEST(LogicPlanesTest, CircuitMatchesEvaluate)
+{
+    // q = SR latch set by (a AND b), reset by NOT c; d and dBar latch q clocked by a
+    Circuit circuit;
+    auto a = circuit.AddNet();
+    auto b = circuit.AddNet();
+    auto c = circuit.AddNet();
+    auto set = circuit.AddNet();
+    auto reset = circuit.AddNet();
+    auto q = circuit.AddNet();
+    auto d = circuit.AddNet();
+    auto dBar = circuit.AddNet();
+    circuit.AddGate(GateOp::DLatch, q, a, d);
+    circuit.AddGate(GateOp::DLatchInverse, q, a, dBar);
+    circuit.AddGate(GateOp::SRLatch, set, reset, q);
+    circuit.AddGate(GateOp::Not, c, Circuit::UnconnectedNet, reset);
+    circuit.AddGate(GateOp::And, a, b, set);
+    circuit.Compile();
+
+    // two steps of every combination of three inputs
+    const size_t scenarios = 27 * 27;
+    LogicPlanes planes(circuit.GetNetCount(), scenarios);
+    auto input = [](size_t s, int step, int which)
+    {
+        size_t combination = step == 0 ? s % 27 : s / 27;
+        for (int i = 0; i < which; i++)
+        {
+            combination /= 3;
+        }
+        return PlaneStates[combination % 3];
+    };
+
+    for (int step = 0; step < 2; step++)
+    {
+        for (size_t s = 0; s < scenarios; s++)
+        {
+            planes.Set(a, s, input(s, step, 0));
+            planes.Set(b, s, input(s, step, 1));
+            planes.Set(c, s, input(s, step, 2));
+        }
+        circuit.EvaluatePlanes(planes);
+    }
+
+    for (size_t s = 0; s < scenarios; s++)
+    {
+        Circuit single = circuit;
+        for (int step = 0; step < 2; step++)
+        {
+            single.SetNet(a, input(s, step, 0));
+            single.SetNet(b, input(s, step, 1));
+            single.SetNet(c, input(s, step, 2));
+            single.Evaluate();
+        }
+
+        for (uint32_t net = 0; net < circuit.GetNetCount(); net++)
+        {
+            ASSERT_EQ(single.GetNet(net), planes.Get(net, s)) << "net " << net << " scenario " << s;
+        }
+    }
+}
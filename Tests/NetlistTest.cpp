@@ -0,0 +1,107 @@
+/**
+ * @file NetlistTest.cpp
+ * @author Yeji Lee
+ */
+
+#include "gtest/gtest.h"
+#include <Netlist.h>
+#include <vector>
+
+/**
+ * copy the fan-out of an output into a vector
+ * @param netlist the netlist
+ * @param output the output pin
+ * @return the input pins it drives
+ */
+static std::vector<uint32_t> FanoutOf(const Netlist& netlist, uint32_t output)
+{
+    auto fanout = netlist.GetFanout(output);
+    return std::vector<uint32_t>(fanout.begin(), fanout.end());
+}
+
+TEST(NetlistTest, Empty)
+{
+    Netlist netlist;
+    netlist.Resize(2, 3);
+    ASSERT_EQ(2, netlist.GetOutputCount());
+    ASSERT_EQ(3, netlist.GetInputCount());
+    ASSERT_EQ(0, netlist.GetWireCount());
+    ASSERT_TRUE(netlist.GetFanout(1).empty());
+    ASSERT_EQ(Netlist::NoPin, netlist.GetDriver(2));
+}
+
+TEST(NetlistTest, ConnectDisconnect)
+{
+    Netlist netlist;
+    netlist.Resize(3, 5);
+
+    netlist.Connect(1, 4);
+    netlist.Connect(1, 0);
+    netlist.Connect(2, 3);
+    ASSERT_EQ(3, netlist.GetWireCount());
+    ASSERT_EQ((std::vector<uint32_t>{0, 4}), FanoutOf(netlist, 1));
+    ASSERT_EQ((std::vector<uint32_t>{3}), FanoutOf(netlist, 2));
+    ASSERT_TRUE(netlist.GetFanout(0).empty());
+    ASSERT_EQ(1, netlist.GetDriver(4));
+
+    // an input has one driver, wiring it again moves the wire
+    netlist.Connect(0, 4);
+    ASSERT_EQ(3, netlist.GetWireCount());
+    ASSERT_EQ((std::vector<uint32_t>{0}), FanoutOf(netlist, 1));
+    ASSERT_EQ((std::vector<uint32_t>{4}), FanoutOf(netlist, 0));
+
+    // removing a wire that is not there does nothing
+    netlist.Disconnect(2, 4);
+    ASSERT_EQ(0, netlist.GetDriver(4));
+
+    netlist.Disconnect(0, 4);
+    ASSERT_EQ(Netlist::NoPin, netlist.GetDriver(4));
+    ASSERT_EQ(2, netlist.GetWireCount());
+}
+
+TEST(NetlistTest, ResizeKeepsWires)
+{
+    Netlist netlist;
+    netlist.Resize(2, 2);
+    netlist.Connect(0, 0);
+    netlist.Connect(1, 1);
+
+    // pins added by a new item
+    netlist.Resize(4, 3);
+    ASSERT_EQ((std::vector<uint32_t>{0}), FanoutOf(netlist, 0));
+    ASSERT_EQ((std::vector<uint32_t>{1}), FanoutOf(netlist, 1));
+    ASSERT_TRUE(netlist.GetFanout(3).empty());
+
+    // wires to outputs that are gone go too
+    netlist.Resize(1, 3);
+    ASSERT_EQ(1, netlist.GetWireCount());
+    ASSERT_EQ(Netlist::NoPin, netlist.GetDriver(1));
+
+    netlist.Clear();
+    ASSERT_EQ(0, netlist.GetOutputCount());
+    ASSERT_EQ(0, netlist.GetInputCount());
+}
+
+TEST(NetlistTest, RemovePins)
+{
+    Netlist netlist;
+    netlist.Resize(2, 3);
+    netlist.Connect(0, 0);
+    netlist.Connect(0, 1);
+    netlist.Connect(1, 2);
+
+    // an output going away takes all of its wires
+    netlist.RemoveOutput(0);
+    ASSERT_EQ(1, netlist.GetWireCount());
+    ASSERT_TRUE(netlist.GetFanout(0).empty());
+    ASSERT_EQ(Netlist::NoPin, netlist.GetDriver(1));
+
+    netlist.RemoveInput(2);
+    ASSERT_EQ(0, netlist.GetWireCount());
+    ASSERT_TRUE(netlist.GetFanout(1).empty());
+
+    // pins that were never there are ignored
+    netlist.RemoveOutput(7);
+    netlist.RemoveInput(7);
+    ASSERT_EQ(0, netlist.GetWireCount());
+}
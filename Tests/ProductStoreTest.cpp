@@ -0,0 +1,139 @@
+/**
+ * @file ProductStoreTest.cpp
+ * @author Yeji Lee
+ */
+
+#include "gtest/gtest.h"
+#include <ProductStore.h>
+#include <ProductModel.h>
+#include <ConveyorModel.h>
+#include <memory>
+#include <vector>
+
+/**
+ * make a product for the tests
+ * @param kick should the product be kicked
+ * @return the product
+ */
+static std::unique_ptr<ProductModel> MakeProduct(bool kick = false)
+{
+    return std::make_unique<ProductModel>(100, ProductModel::Properties::Diamond,
+                                          ProductModel::Properties::Blue,
+                                          ProductModel::Properties::Football, kick);
+}
+
+TEST(ProductStoreTest, ViewKeepsProperties)
+{
+    auto product = MakeProduct(true);
+    ASSERT_EQ(ProductModel::Properties::Diamond, product->GetShape());
+    ASSERT_EQ(ProductModel::Properties::Blue, product->GetColor());
+    ASSERT_EQ(ProductModel::Properties::Football, product->GetContent());
+    ASSERT_TRUE(product->ShouldKick());
+
+    ConveyorModel conveyor(205, 400, 100, 800);
+    product->SetLocation(205, 300);
+    product->SetPassedBeam(true);
+    product->SetConveyor(&conveyor);
+
+    // the row moved to the conveyor with everything in it
+    ASSERT_EQ(conveyor.GetProducts().get(), &product->GetStore());
+    ASSERT_EQ(ProductModel::Properties::Football, product->GetContent());
+    ASSERT_TRUE(product->ShouldKick());
+    ASSERT_TRUE(product->GetPassedBeam());
+    ASSERT_NEAR(300, product->GetY(), 0.001);
+    ASSERT_TRUE(product->IsOnConveyor(&conveyor));
+}
+
+TEST(ProductStoreTest, ConveyorMovesItsProducts)
+{
+    ConveyorModel conveyor(205, 400, 100, 800);
+    auto riding = MakeProduct();
+    auto kicked = MakeProduct();
+    auto off = MakeProduct();
+    for (auto product : {riding.get(), kicked.get(), off.get()})
+    {
+        product->SetConveyor(&conveyor);
+        product->SetLocation(205, 300);
+    }
+    kicked->SetKicked(true, 200);
+    off->SetOnConveyor(false);
+
+    // stopped belt, only the kick moves anything
+    conveyor.Update(0.5);
+    ASSERT_NEAR(300, riding->GetY(), 0.001);
+    ASSERT_NEAR(105, kicked->GetX(), 0.001);
+
+    conveyor.Start();
+    conveyor.Update(0.5);
+    ASSERT_NEAR(350, riding->GetY(), 0.001);
+    ASSERT_NEAR(350, kicked->GetY(), 0.001);
+    ASSERT_NEAR(5, kicked->GetX(), 0.001);
+    ASSERT_NEAR(300, off->GetY(), 0.001);
+    ASSERT_NEAR(205, off->GetX(), 0.001);
+
+    // a destroyed product's row is removed, and the last row takes its place
+    auto& store = *conveyor.GetProducts();
+    ASSERT_EQ(3u, store.size());
+    auto row = riding->GetRow();
+    riding.reset();
+    ASSERT_EQ(2u, store.size());
+    ASSERT_EQ(row, off->GetRow());
+    conveyor.Update(0.5);
+    ASSERT_NEAR(400, kicked->GetY(), 0.001);
+    ASSERT_NEAR(300, off->GetY(), 0.001);
+    ASSERT_NEAR(205, off->GetX(), 0.001);
+}
+
+TEST(ProductStoreTest, ManyProductsMatchOneAtATime)
+{
+    const int count = 20000;
+    ConveyorModel conveyor(205, 400, 100, 800);
+    std::vector<std::unique_ptr<ProductModel>> products;
+    for (int i = 0; i < count; i++)
+    {
+        products.push_back(MakeProduct());
+        products.back()->SetConveyor(&conveyor);
+        products.back()->SetLocation(205, 400 - i);
+        if (i % 3 == 0)
+        {
+            products.back()->SetKicked(true, 1000);
+        }
+    }
+
+    conveyor.Start();
+    for (int step = 0; step < 10; step++)
+    {
+        conveyor.Update(0.01);
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        ASSERT_NEAR(400 - i + 10.0, products[i]->GetY(), 1e-9);
+        ASSERT_NEAR(i % 3 == 0 ? 105 : 205, products[i]->GetX(), 1e-9);
+    }
+}
+
+TEST(ProductStoreTest, LastProductDelay)
+{
+    ConveyorModel conveyor(205, 400, 100, 800);
+    auto first = MakeProduct();
+    first->SetConveyor(&conveyor);
+    auto product = MakeProduct();
+    product->SetConveyor(&conveyor);
+    product->SetLast(true);
+
+    // the last product keeps its delay when its row moves
+    first.reset();
+    ASSERT_EQ(0u, product->GetRow());
+
+    ASSERT_FALSE(conveyor.Update(1));
+    product->HasPassedBeam();
+    ASSERT_FALSE(conveyor.Update(2));
+    ASSERT_TRUE(conveyor.Update(2));
+    ASSERT_FALSE(conveyor.Update(2));
+
+    // no longer last, so passing the beam ends nothing
+    product->SetLast(false);
+    product->HasPassedBeam();
+    ASSERT_FALSE(conveyor.Update(5));
+}
@@ -7,6 +7,7 @@
 #include "gtest/gtest.h"
 #include <Game.h>
 #include <Product.h>
+#include <ResourceCache.h>
 
 class ProductTest : public ::testing::Test
 {
@@ -82,8 +83,7 @@ TEST_F(ProductTest, MovementTest)
 
     product->SetLocation(150, 400);
 
-    double conveyorSpeed = 100.0; // 100 pixels per second
-    product->SetOnConveyor(true, conveyorSpeed);
+    product->SetOnConveyor(true);
 
     // update for 1 second
     product->Update(1.0);
@@ -121,7 +121,7 @@ TEST_F(ProductTest, CombinedMovementTest)
 
     product->SetLocation(150, 400);
 
-    product->SetOnConveyor(true, 100.0);
+    product->SetOnConveyor(true);
     product->Update(1.0);
 
     product->SetKicked(true, 200.0);
@@ -130,3 +130,27 @@ TEST_F(ProductTest, CombinedMovementTest)
     ASSERT_NEAR(50, product->GetX(), 0.1);
     ASSERT_NEAR(400, product->GetY(), 0.1);
 }
+
+TEST_F(ProductTest, SharedContentImage)
+{
+    auto before = ResourceCache::Get().GetUsage();
+
+    std::vector<std::shared_ptr<Product>> products;
+    for (int i = 0; i < 10; i++)
+    {
+        products.push_back(std::make_shared<Product>(&mGame, 100 * i,
+                                                     Product::Properties::Square,
+                                                     Product::Properties::Red,
+                                                     Product::Properties::Football,
+                                                     false));
+    }
+
+    // ten more users, but at most one more decoded image
+    auto after = ResourceCache::Get().GetUsage();
+    ASSERT_EQ(before.mUsers + 10, after.mUsers);
+    ASSERT_LE(after.mImages, before.mImages + 1);
+    ASSERT_LE(before.mCachedBytes, after.mCachedBytes);
+
+    products.clear();
+    ASSERT_EQ(before.mUsers, ResourceCache::Get().GetUsage().mUsers);
+}
@@ -0,0 +1,165 @@
+/**
+ * @file ScenarioBatchTest.cpp
+ * @author Yeji Lee
+ */
+
+#include "gtest/gtest.h"
+#include <ScenarioBatch.h>
+#include <memory>
+
+/**
+ * make a product for a batch
+ * @param shape its shape
+ * @param color its color
+ * @param shouldKick should it be kicked
+ * @return the product
+ */
+static std::shared_ptr<ProductModel> MakeProduct(ProductModel::Properties shape, ProductModel::Properties color,
+                                                 bool shouldKick)
+{
+    return std::make_shared<ProductModel>(100, shape, color, ProductModel::Properties::None, shouldKick);
+}
+
+TEST(ScenarioBatchTest, MatchesEvaluate)
+{
+    // out = (red AND square) OR NOT circle, and a gate with an unconnected input
+    Circuit circuit;
+    auto red = circuit.AddNet();
+    auto square = circuit.AddNet();
+    auto circle = circuit.AddNet();
+    auto andOut = circuit.AddNet();
+    auto notOut = circuit.AddNet();
+    auto out = circuit.AddNet();
+    auto halfWired = circuit.AddNet();
+    circuit.AddGate(GateOp::Or, andOut, notOut, out);
+    circuit.AddGate(GateOp::Not, circle, Circuit::UnconnectedNet, notOut);
+    circuit.AddGate(GateOp::And, red, square, andOut);
+    circuit.AddGate(GateOp::And, red, Circuit::UnconnectedNet, halfWired);
+    circuit.Compile();
+
+    ScenarioBatch batch;
+    batch.AddSensorNet(red, ProductModel::Properties::Red);
+    batch.AddSensorNet(square, ProductModel::Properties::Square);
+    batch.AddSensorNet(circle, ProductModel::Properties::Circle);
+
+    const ProductModel::Properties shapes[] = {ProductModel::Properties::Square, ProductModel::Properties::Circle,
+                                               ProductModel::Properties::Diamond};
+    const ProductModel::Properties colors[] = {ProductModel::Properties::Red, ProductModel::Properties::Green};
+    std::vector<std::shared_ptr<ProductModel>> owned;
+    std::vector<ProductModel*> products;
+    for (int i = 0; i < 100; i++)
+    {
+        owned.push_back(MakeProduct(shapes[i % 3], colors[i / 3 % 2], false));
+        products.push_back(owned.back().get());
+    }
+
+    auto kicks = batch.Evaluate(circuit, products, {out});
+    ASSERT_EQ(2u, kicks.size());
+    ASSERT_EQ(0u, kicks.back() >> (100 - 64));
+
+    // the half wired gate is Unknown for every product, so it never kicks
+    auto halfWiredKicks = batch.Evaluate(circuit, products, {halfWired});
+    ASSERT_EQ(std::vector<uint64_t>(2, 0), halfWiredKicks);
+
+    for (size_t i = 0; i < products.size(); i++)
+    {
+        Circuit single = circuit;
+        for (auto property : {ProductModel::Properties::Red, ProductModel::Properties::Square,
+                              ProductModel::Properties::Circle})
+        {
+            bool has = products[i]->GetShape() == property || products[i]->GetColor() == property;
+            auto net = property == ProductModel::Properties::Red ? red :
+                       property == ProductModel::Properties::Square ? square : circle;
+            single.SetNet(net, has ? States::One : States::Zero);
+        }
+        single.Evaluate();
+
+        bool kicked = (kicks[i / 64] >> (i % 64)) & 1;
+        ASSERT_EQ(single.GetNet(out) == States::One, kicked) << "product " << i;
+        ASSERT_EQ(States::Unknown, single.GetNet(halfWired));
+    }
+}
+
+TEST(ScenarioBatchTest, LatchStartsFromCircuit)
+{
+    // the latch is only set by red, so the others see what it held before
+    Circuit circuit;
+    auto red = circuit.AddNet();
+    auto reset = circuit.AddNet();
+    auto q = circuit.AddNet();
+    circuit.AddGate(GateOp::SRLatch, red, reset, q);
+    circuit.Compile();
+
+    ScenarioBatch batch;
+    batch.AddSensorNet(red, ProductModel::Properties::Red);
+    batch.AddBeamNet(reset);
+
+    auto redProduct = MakeProduct(ProductModel::Properties::Square, ProductModel::Properties::Red, true);
+    auto greenProduct = MakeProduct(ProductModel::Properties::Square, ProductModel::Properties::Green, false);
+    std::vector<ProductModel*> products = {redProduct.get(), greenProduct.get()};
+
+    // never set, so Unknown and no kick
+    ASSERT_EQ(std::vector<uint64_t>{0b01}, batch.Evaluate(circuit, products, {q}));
+
+    circuit.SetNet(red, States::One);
+    circuit.SetNet(reset, States::Zero);
+    circuit.Evaluate();
+    ASSERT_EQ(std::vector<uint64_t>{0b11}, batch.Evaluate(circuit, products, {q}));
+}
+
+TEST(ScenarioBatchTest, SortsProducts)
+{
+    // kick anything red that is not a circle
+    Circuit circuit;
+    auto red = circuit.AddNet();
+    auto circle = circuit.AddNet();
+    auto notCircle = circuit.AddNet();
+    auto kick = circuit.AddNet();
+    circuit.AddGate(GateOp::Not, circle, Circuit::UnconnectedNet, notCircle);
+    circuit.AddGate(GateOp::And, red, notCircle, kick);
+    circuit.Compile();
+
+    ScenarioBatch batch;
+    batch.AddSensorNet(red, ProductModel::Properties::Red);
+    batch.AddSensorNet(circle, ProductModel::Properties::Circle);
+
+    // more products than fit in one word, cycling through three kinds
+    std::vector<std::shared_ptr<ProductModel>> owned;
+    std::vector<ProductModel*> products;
+    for (int i = 0; i < 100; i++)
+    {
+        auto shape = i % 3 == 1 ? ProductModel::Properties::Circle : ProductModel::Properties::Square;
+        auto color = i % 3 == 2 ? ProductModel::Properties::Green : ProductModel::Properties::Red;
+        owned.push_back(MakeProduct(shape, color, i % 3 == 0));
+        products.push_back(owned.back().get());
+    }
+
+    auto kicks = batch.Evaluate(circuit, products, {kick});
+    ASSERT_EQ(ScenarioBatch::KickMask(products), kicks);
+    ASSERT_NE(0u, kicks[0]);
+    ASSERT_NE(0u, kicks[1]);
+}
+
+TEST(ScenarioBatchTest, EverySparty)
+{
+    // one Sparty reads red, the other square, and either kicks
+    Circuit circuit;
+    auto red = circuit.AddNet();
+    auto square = circuit.AddNet();
+    circuit.Compile();
+
+    ScenarioBatch batch;
+    batch.AddSensorNet(red, ProductModel::Properties::Red);
+    batch.AddSensorNet(square, ProductModel::Properties::Square);
+
+    auto redCircle = MakeProduct(ProductModel::Properties::Circle, ProductModel::Properties::Red, true);
+    auto greenSquare = MakeProduct(ProductModel::Properties::Square, ProductModel::Properties::Green, true);
+    auto greenCircle = MakeProduct(ProductModel::Properties::Circle, ProductModel::Properties::Green, false);
+    std::vector<ProductModel*> products = {redCircle.get(), greenSquare.get(), greenCircle.get()};
+
+    ASSERT_EQ(std::vector<uint64_t>{0b001}, batch.Evaluate(circuit, products, {red}));
+    ASSERT_EQ(ScenarioBatch::KickMask(products), batch.Evaluate(circuit, products, {red, square}));
+
+    // no Sparty, no kicks
+    ASSERT_EQ(std::vector<uint64_t>{0}, batch.Evaluate(circuit, products, {}));
+}
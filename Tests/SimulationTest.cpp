@@ -0,0 +1,154 @@
+/**
+ * @file SimulationTest.cpp
+ * @author Yeji Lee
+ */
+
+#include "gtest/gtest.h"
+#include <Simulation.h>
+#include <algorithm>
+
+class SimulationTest : public ::testing::Test
+{
+protected:
+    Simulation mSimulation;
+    std::shared_ptr<ConveyorModel> mConveyor;
+
+    void SetUp() override
+    {
+        mConveyor = std::make_shared<ConveyorModel>(205, 400, 100, 800);
+        mSimulation.AddConveyor(mConveyor);
+    }
+
+    std::shared_ptr<ProductModel> AddProduct(int placement)
+    {
+        auto product = std::make_shared<ProductModel>(placement,
+                                                      ProductModel::Properties::Square,
+                                                      ProductModel::Properties::Red,
+                                                      ProductModel::Properties::None,
+                                                      false);
+        product->SetConveyor(mConveyor.get());
+        product->SetLocation(mConveyor->GetX(), mConveyor->GetY() - placement);
+        mSimulation.AddProduct(product);
+        return product;
+    }
+};
+
+TEST_F(SimulationTest, ProductsMoveOnlyWhenRunning)
+{
+    auto product = AddProduct(100);
+
+    mSimulation.Update(1.0);
+    ASSERT_NEAR(300, product->GetY(), 0.001);
+
+    mSimulation.StartConveyor(mConveyor.get());
+    mSimulation.Update(1.0);
+    ASSERT_NEAR(400, product->GetY(), 0.001);
+    ASSERT_NEAR(100, mConveyor->GetBeltOffset(), 0.001);
+}
+
+TEST_F(SimulationTest, StartResetsProducts)
+{
+    auto product = AddProduct(100);
+
+    mSimulation.StartConveyor(mConveyor.get());
+    mSimulation.Update(0.5);
+    ASSERT_NEAR(350, product->GetY(), 0.001);
+
+    mSimulation.StartConveyor(mConveyor.get());
+    ASSERT_NEAR(300, product->GetY(), 0.001);
+}
+
+TEST_F(SimulationTest, BeamBreaksAndSpartyKicks)
+{
+    auto beam = std::make_shared<BeamModel>(297, 437, -185);
+    auto sparty = std::make_shared<SpartyModel>(345, 340, 300, 1100, 400, 0.25, 1000);
+    mSimulation.AddBeam(beam);
+    mSimulation.AddSparty(sparty);
+
+    auto product = AddProduct(100);
+    mSimulation.StartConveyor(mConveyor.get());
+
+    mSimulation.Update(0.5);
+    ASSERT_FALSE(beam->IsBroken());
+    ASSERT_FALSE(sparty->IsKicking());
+
+    mSimulation.Update(0.5);
+    ASSERT_TRUE(beam->IsBroken());
+    ASSERT_EQ(States::Zero, beam->GetOutputState());
+    ASSERT_TRUE(product->GetPassedBeam());
+    ASSERT_TRUE(sparty->IsKicking());
+}
+
+TEST_F(SimulationTest, LastProductEndsLevel)
+{
+    auto beam = std::make_shared<BeamModel>(297, 437, -185);
+    mSimulation.AddBeam(beam);
+
+    auto product = AddProduct(100);
+    product->SetLast(true);
+    mSimulation.StartConveyor(mConveyor.get());
+
+    // reaches the beam after one second, leaves it about one second later
+    for (int i = 0; i < 20; i++)
+    {
+        mSimulation.Update(0.1);
+    }
+    ASSERT_FALSE(mSimulation.IsLevelComplete());
+
+    for (int i = 0; i < 40; i++)
+    {
+        mSimulation.Update(0.1);
+    }
+    ASSERT_TRUE(mSimulation.IsLevelComplete());
+
+    mSimulation.Clear();
+    ASSERT_FALSE(mSimulation.IsLevelComplete());
+    ASSERT_TRUE(mSimulation.GetProducts().empty());
+}
+
+TEST_F(SimulationTest, BeamsPublishIntersectingProducts)
+{
+    auto upper = std::make_shared<BeamModel>(297, 300, -185);
+    auto lower = std::make_shared<BeamModel>(297, 437, -185);
+    mSimulation.AddBeam(lower);
+    mSimulation.AddBeam(upper);
+
+    // added out of order, the sweep has to sort them
+    auto atLower = AddProduct(0);
+    auto atUpper = AddProduct(100);
+    auto between = AddProduct(30);
+    auto offBelt = AddProduct(100);
+    atLower->SetLocation(205, 440);
+    atUpper->SetLocation(205, 330);
+    between->SetLocation(205, 370);
+    offBelt->SetLocation(600, 300);
+
+    mSimulation.UpdateBeams();
+
+    ASSERT_EQ(1, upper->GetIntersecting().size());
+    ASSERT_EQ(atUpper.get(), upper->GetIntersecting()[0]);
+    ASSERT_EQ(1, lower->GetIntersecting().size());
+    ASSERT_EQ(atLower.get(), lower->GetIntersecting()[0]);
+    ASSERT_FALSE(between->GetPassedBeam());
+    ASSERT_FALSE(offBelt->GetPassedBeam());
+
+    // the sweep agrees with testing every pair
+    for (const auto& product : mSimulation.GetProducts())
+    {
+        for (const auto& beam : mSimulation.GetBeams())
+        {
+            auto& intersecting = beam->GetIntersecting();
+            bool found = std::find(intersecting.begin(), intersecting.end(), product.get()) != intersecting.end();
+            ASSERT_EQ(beam->IsIntersecting(*product), found);
+        }
+    }
+
+    // products swap sides of the beams, the sorted order has to follow
+    atUpper->SetLocation(205, 600);
+    atLower->SetLocation(205, 200);
+    mSimulation.UpdateBeams();
+    ASSERT_TRUE(upper->GetIntersecting().empty());
+    ASSERT_TRUE(lower->GetIntersecting().empty());
+    ASSERT_FALSE(upper->IsBroken());
+    ASSERT_TRUE(upper->HasChanged());
+}
@@ -0,0 +1,90 @@
+/**
+ * @file SlotMapTest.cpp
+ * @author Yeji Lee
+ */
+
+#include "gtest/gtest.h"
+#include <SlotMap.h>
+#include <string>
+
+TEST(SlotMapTest, AddGet)
+{
+    SlotMap<std::string> map;
+    auto a = map.Add("a");
+    auto b = map.Add("b");
+
+    ASSERT_EQ(2, map.size());
+    ASSERT_NE(a, b);
+    ASSERT_EQ("a", *map.Get(a));
+    ASSERT_EQ("b", *map.Get(b));
+    ASSERT_EQ(map.Get(b), map.GetAt(b.GetSlot()));
+
+    SlotMap<std::string>::Handle none;
+    ASSERT_FALSE(none.IsSet());
+    ASSERT_EQ(nullptr, map.Get(none));
+}
+
+TEST(SlotMapTest, RemoveKeepsOthers)
+{
+    SlotMap<int> map;
+    auto a = map.Add(1);
+    auto b = map.Add(2);
+    auto c = map.Add(3);
+
+    // the last object moves into the hole, but its handle still works
+    ASSERT_TRUE(map.Remove(a));
+    ASSERT_EQ(2, map.size());
+    ASSERT_EQ(nullptr, map.Get(a));
+    ASSERT_EQ(2, *map.Get(b));
+    ASSERT_EQ(3, *map.Get(c));
+
+    int sum = 0;
+    for (auto value : map)
+    {
+        sum += value;
+    }
+    ASSERT_EQ(5, sum);
+
+    // removing twice does nothing
+    ASSERT_FALSE(map.Remove(a));
+    ASSERT_EQ(2, map.size());
+}
+
+TEST(SlotMapTest, StaleHandle)
+{
+    SlotMap<int> map;
+    auto a = map.Add(1);
+    map.Remove(a);
+
+    // the slot is reused, but the old handle does not reach the new object
+    auto b = map.Add(2);
+    ASSERT_EQ(a.GetSlot(), b.GetSlot());
+    ASSERT_NE(a, b);
+    ASSERT_EQ(nullptr, map.Get(a));
+    ASSERT_FALSE(map.Remove(a));
+    ASSERT_EQ(2, *map.Get(b));
+    ASSERT_EQ(1, map.GetSlotCount());
+
+    // a handle made from the slot is the current one
+    ASSERT_EQ(b, map.GetHandleAt(b.GetSlot()));
+    map.Remove(b);
+    ASSERT_FALSE(map.GetHandleAt(b.GetSlot()).IsSet());
+}
+
+TEST(SlotMapTest, Clear)
+{
+    SlotMap<int> map;
+    auto a = map.Add(1);
+    auto b = map.Add(2);
+    map.Clear();
+
+    ASSERT_EQ(0, map.size());
+    ASSERT_EQ(nullptr, map.Get(a));
+    ASSERT_EQ(nullptr, map.Get(b));
+    ASSERT_EQ(nullptr, map.GetAt(a.GetSlot()));
+
+    // slots are reused from the lowest
+    auto c = map.Add(3);
+    ASSERT_EQ(0, c.GetSlot());
+    ASSERT_EQ(2, map.GetSlotCount());
+}
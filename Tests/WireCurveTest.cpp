@@ -0,0 +1,52 @@
+/**
+ * @file WireCurveTest.cpp
+ * @author Yeji Lee
+ */
+
+#include "gtest/gtest.h"
+#include <WireCurve.h>
+
+TEST(WireCurveTest, Flatten)
+{
+    WireCurve curve;
+    ASSERT_TRUE(curve.GetPoints().empty());
+
+    ASSERT_TRUE(curve.SetEnds(100, 100, 400, 300));
+    const auto& points = curve.GetPoints();
+    ASSERT_GE(points.size(), 3u);
+    ASSERT_LE(points.size(), WireCurve::MaxSegments + 1);
+
+    ASSERT_DOUBLE_EQ(points.front().mX, 100);
+    ASSERT_DOUBLE_EQ(points.front().mY, 100);
+    ASSERT_DOUBLE_EQ(points.back().mX, 400);
+    ASSERT_DOUBLE_EQ(points.back().mY, 300);
+
+    // halfway along, the curve crosses the middle of the two ends
+    ASSERT_NEAR(points[points.size() / 2].mY, 200, 1e-9);
+
+    auto bounds = curve.GetBounds(3);
+    for (const auto& point : points)
+    {
+        ASSERT_GE(point.mX, bounds.mLeft);
+        ASSERT_LE(point.mX, bounds.mRight);
+        ASSERT_GE(point.mY, bounds.mTop);
+        ASSERT_LE(point.mY, bounds.mBottom);
+    }
+    ASSERT_DOUBLE_EQ(bounds.mTop, 97);
+    ASSERT_DOUBLE_EQ(bounds.mBottom, 303);
+}
+
+TEST(WireCurveTest, OnlyWhenMoved)
+{
+    WireCurve curve;
+    ASSERT_TRUE(curve.SetEnds(0, 0, 10, 0));
+    ASSERT_FALSE(curve.SetEnds(0, 0, 10, 0));
+    ASSERT_EQ(curve.GetPoints().size(), 5u);
+
+    // wiring backwards loops out past both ends
+    ASSERT_TRUE(curve.SetEnds(500, 0, 100, 50));
+    auto bounds = curve.GetBounds(0);
+    ASSERT_DOUBLE_EQ(bounds.mLeft, -100);
+    ASSERT_DOUBLE_EQ(bounds.mRight, 700);
+    ASSERT_EQ(curve.GetPoints().size(), WireCurve::MaxSegments + 1);
+}
@@ -0,0 +1,163 @@
+/**
+ * @file FrameDump.cpp
+ * @author Yeji Lee
+ *
+ * Plays a level without a window and saves or times its frames.
+ *
+ * Usage: FrameDump [-l level] [-s WIDTHxHEIGHT] [-n frames] [-o directory] [-t]
+ *
+ * Run it where the images and levels directories are, as for the
+ * game. The conveyors are started and the game advances a 60 Hz frame
+ * between renders. Each frame is saved as frameNNNN.png in the
+ * directory given with -o, the current one by default. With -t no
+ * frames are saved and the draw time per frame is reported instead.
+ *
+ * No top-level window is created, but on GTK the toolkit still
+ * connects to a display for fonts, so use xvfb-run on a server.
+ */
+
+#include "pch.h"
+#include <Game.h>
+#include <FrameRenderer.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+/// Clock used for the timings
+typedef std::chrono::steady_clock Clock;
+
+/// Game time between frames, in seconds
+const double FrameTime = 1.0 / 60;
+
+/**
+ * render the frames asked for on the command line
+ *
+ * @param argc number of arguments
+ * @param argv the arguments
+ * @return 0 if every frame was rendered and saved
+ */
+int main(int argc, char* argv[])
+{
+    int level = 1;
+    int width = 1150;
+    int height = 800;
+    int frames = 1;
+    std::filesystem::path directory = ".";
+    bool timing = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string argument = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (argument == "-l" && hasValue)
+        {
+            level = std::atoi(argv[++i]);
+        }
+        else if (argument == "-s" && hasValue)
+        {
+            if (std::sscanf(argv[++i], "%dx%d", &width, &height) != 2)
+            {
+                width = 0;
+            }
+        }
+        else if (argument == "-n" && hasValue)
+        {
+            frames = std::atoi(argv[++i]);
+        }
+        else if (argument == "-o" && hasValue)
+        {
+            directory = argv[++i];
+        }
+        else if (argument == "-t")
+        {
+            timing = true;
+        }
+        else
+        {
+            std::fprintf(stderr, "Usage: FrameDump [-l level] [-s WIDTHxHEIGHT] [-n frames] [-o directory] [-t]\n");
+            return 1;
+        }
+    }
+
+    if (width <= 0 || height <= 0 || frames <= 0)
+    {
+        std::fprintf(stderr, "FrameDump: size and frames must be positive\n");
+        return 1;
+    }
+
+    wxInitializer initializer;
+    if (!initializer.IsOk())
+    {
+        std::fprintf(stderr, "FrameDump: unable to initialize wxWidgets\n");
+        return 1;
+    }
+    wxInitAllImageHandlers();
+
+    std::error_code error;
+    if (!timing && !std::filesystem::create_directories(directory, error) && error)
+    {
+        std::fprintf(stderr, "FrameDump: unable to create %s\n", directory.string().c_str());
+        return 1;
+    }
+
+    auto game = std::make_unique<Game>();
+    game->StartLevel(level);
+    game->SetState(Game::GameState::Playing);
+    for (auto conveyor : game->GetRegistry().GetConveyors())
+    {
+        conveyor->Start();
+    }
+
+    FrameRenderer renderer(width, height);
+    std::vector<double> times;
+    for (int frame = 0; frame < frames; frame++)
+    {
+        if (frame > 0)
+        {
+            game->Advance(FrameTime);
+        }
+
+        auto start = Clock::now();
+        const auto& image = renderer.Render(*game);
+        times.push_back(std::chrono::duration<double>(Clock::now() - start).count());
+
+        if (!timing)
+        {
+            char name[32];
+            std::snprintf(name, sizeof(name), "frame%04d.png", frame);
+            auto path = directory / name;
+            if (!image.SaveFile(path.string(), wxBITMAP_TYPE_PNG))
+            {
+                std::fprintf(stderr, "FrameDump: unable to save %s\n", path.string().c_str());
+                return 1;
+            }
+        }
+    }
+
+    if (timing)
+    {
+        // the first frame also draws the static layer
+        double first = times.front();
+        std::sort(times.begin(), times.end());
+        double total = 0;
+        for (auto time : times)
+        {
+            total += time;
+        }
+        std::printf("level %d at %dx%d, %d frames\n", level, width, height, frames);
+        std::printf("%-8s %12.3f ms\n", "first", first * 1000);
+        std::printf("%-8s %12.3f ms\n", "mean", total * 1000 / times.size());
+        std::printf("%-8s %12.3f ms\n", "median", times[times.size() / 2] * 1000);
+        std::printf("%-8s %12.3f ms\n", "max", times.back() * 1000);
+    }
+    else
+    {
+        std::printf("%d frames of level %d at %dx%d in %s\n", frames, level, width, height, directory.string().c_str());
+    }
+    return 0;
+}
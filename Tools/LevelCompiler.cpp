@@ -0,0 +1,80 @@
+/**
+ * @file LevelCompiler.cpp
+ * @author Yeji Lee
+ *
+ * Compiles XML levels to the binary LevelFile format the game maps.
+ *
+ * Usage: LevelCompiler level.xml... [-o directory]
+ *
+ * Each level.xml is written as level.level, beside it or in the
+ * directory given with -o.
+ */
+
+#include <LevelFile.h>
+#include <LevelReader.h>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+/**
+ * compile the levels named on the command line
+ *
+ * @param argc number of arguments
+ * @param argv the arguments
+ * @return 0 if every level compiled
+ */
+int main(int argc, char* argv[])
+{
+    std::vector<std::filesystem::path> inputs;
+    std::filesystem::path directory;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string argument = argv[i];
+        if (argument == "-o" && i + 1 < argc)
+        {
+            directory = argv[++i];
+        }
+        else
+        {
+            inputs.emplace_back(argument);
+        }
+    }
+
+    if (inputs.empty())
+    {
+        std::fprintf(stderr, "Usage: LevelCompiler level.xml... [-o directory]\n");
+        return 1;
+    }
+
+    std::error_code error;
+    if (!directory.empty() && !std::filesystem::create_directories(directory, error) && error)
+    {
+        std::fprintf(stderr, "LevelCompiler: unable to create %s\n", directory.string().c_str());
+        return 1;
+    }
+
+    int failures = 0;
+    for (const auto& input : inputs)
+    {
+        auto output = input;
+        output.replace_extension(LevelFile::Extension);
+        if (!directory.empty())
+        {
+            output = directory / output.filename();
+        }
+
+        auto level = LevelReader::Read(input);
+        if (!level || !LevelFile::Write(output, level->GetData()))
+        {
+            std::fprintf(stderr, "LevelCompiler: unable to compile %s\n", input.string().c_str());
+            failures++;
+            continue;
+        }
+
+        auto data = level->GetData();
+        std::printf("%s: %u items, %u products\n", output.string().c_str(), data.mItemCount, data.mProductCount);
+    }
+
+    return failures == 0 ? 0 : 1;
+}
@@ -6,7 +6,7 @@
 #include "pch.h"
 #include "Beam.h"
 #include "Game.h"
-#include "ProductVisitor.h"
+#include "ResourceCache.h"
 /// Image for the beam sender and receiver when red
 const std::wstring BeamRedImage = L"images/beam-red.png";
 
@@ -20,6 +20,19 @@ const int BeamPinOffset = 80;
 /// for drawing the line towards the output pin
 const int LineThickness = 3;
 
+/// Reach of the output pin and line around their ends
+const double BeamPinReach = 10;
+
+
+/**
+ * image files a beam loads, so they can be decoded ahead of time
+ *
+ * @return the image files
+ */
+std::vector<std::wstring> Beam::GetImages()
+{
+    return {BeamGreenImage, BeamRedImage};
+}
 
 /**
  * constructor for the beam
@@ -30,12 +43,30 @@ const int LineThickness = 3;
  * @param senderOffset  offset for the sender
  */
 Beam::Beam(Game* game, int x, int y, int senderOffset)
-    : Item(game, BeamGreenImage), mX(x + senderOffset), mY(y), mSenderOffset(senderOffset)
+    : Item(game, BeamGreenImage)
+{
+    mModel = std::make_shared<BeamModel>(x, y, senderOffset);
+    mRedImage = ResourceCache::Get().GetImage(BeamRedImage);
+    mGreenImage = ResourceCache::Get().GetImage(BeamGreenImage);
+    mOutputPin = game->GetPins().AddOutput();
+    GetOutputPin()->SetPosition(x + BeamPinOffset, y);
+}
+
+/**
+ * destructor, returns the output pin to the game
+ */
+Beam::~Beam()
+{
+    GetGame()->GetPins().Remove(mOutputPin);
+}
+
+/**
+ * getter for the output pin
+ * @return the output pin
+ */
+PinOutput* Beam::GetOutputPin() const
 {
-    mRedImage = std::make_unique<wxImage>(BeamRedImage, wxBITMAP_TYPE_PNG);
-    mGreenImage = std::make_unique<wxImage>(BeamGreenImage, wxBITMAP_TYPE_PNG);
-    mOutputPin = std::make_unique<PinOutput>(); // Initialize the PinOutput
-    mOutputPin->SetPosition(mX - senderOffset + BeamPinOffset, mY);
+    return GetGame()->GetPins().Get(mOutputPin);
 }
 
 /**
@@ -44,13 +75,10 @@ Beam::Beam(Game* game, int x, int y, int senderOffset)
  */
 void Beam::Draw(std::shared_ptr<wxGraphicsContext> graphics)
 {
-    if (mRedBitmap.IsNull())
-    {
-        mRedBitmap = graphics->CreateBitmapFromImage(*mRedImage);
-        mGreenBitmap = graphics->CreateBitmapFromImage(*mGreenImage);
-    }
-
-    auto bitmap = mBroken ? mRedBitmap : mGreenBitmap;
+    auto bitmap = ResourceCache::Get().GetBitmap(graphics.get(), mModel->IsBroken() ? mRedImage : mGreenImage);
+    int x = GetX();
+    int y = GetY();
+    int senderOffset = mModel->GetSenderOffset();
     int wid = mRedImage->GetWidth();
     int hit = mRedImage->GetHeight();
 
@@ -60,88 +88,70 @@ void Beam::Draw(std::shared_ptr<wxGraphicsContext> graphics)
 
     // draw the line to the pin
     graphics->SetPen(wxPen(*wxBLACK, LineThickness));
-    graphics->StrokeLine(mX, mY, mOutputPin->GetX(), mOutputPin->GetY()); // Use -> to access methods
-    mOutputPin->Draw(graphics); // Use -> to access methods
+    auto pin = GetOutputPin();
+    graphics->StrokeLine(x, y, pin->GetX(), pin->GetY());
+    pin->Draw(graphics);
 
     graphics->SetPen(laser1);
-    graphics->StrokeLine(mX - mSenderOffset, mY, mX, mY);
+    graphics->StrokeLine(x - senderOffset, y, x, y);
     graphics->SetPen(laser2);
-    graphics->StrokeLine(mX - mSenderOffset, mY, mX, mY);
+    graphics->StrokeLine(x - senderOffset, y, x, y);
 
     // receiver
-    graphics->DrawBitmap(bitmap, mX - wid / 2, mY - hit / 2, wid, hit);
+    graphics->DrawBitmap(bitmap, x - wid / 2, y - hit / 2, wid, hit);
 
     // mirrored
     graphics->PushState();
-    graphics->Translate(mX - mSenderOffset, mY);
+    graphics->Translate(x - senderOffset, y);
     graphics->Scale(-1, 1);
     graphics->DrawBitmap(bitmap, -wid / 2, -hit / 2, wid, hit);
     graphics->PopState();
 }
-
-
 /**
- * update the beam
- * 
- * @param elapsed 
+ * the area the beam draws in: the sender, the receiver, the laser
+ * between them and the line to the output pin
+ *
+ * @return the bounds in virtual pixels
  */
-void Beam::Update(double elapsed)
+DamageRegion::Rect Beam::GetBounds() const
 {
-    bool wasBroken = mBroken;
-    mBroken = false;
+    double x = GetX();
+    double y = GetY();
+    double sender = x - mModel->GetSenderOffset();
+    double halfWidth = mRedImage->GetWidth() / 2.0;
+    double halfHeight = mRedImage->GetHeight() / 2.0;
+
+    DamageRegion::Rect ends = {std::min(x, sender) - halfWidth, y - halfHeight,
+                               std::max(x, sender) + halfWidth, y + halfHeight};
+
+    auto pin = GetOutputPin();
+    double reach = BeamPinReach;
+    DamageRegion::Rect line = {std::min(x, pin->GetX()) - reach, std::min(y, pin->GetY()) - reach,
+                               std::max(x, pin->GetX()) + reach, std::max(y, pin->GetY()) + reach};
+    return ends.Union(line);
+}
 
-    ProductVisitor productVisitor;
-    for (const auto& item : GetGame()->GetItems())
-    {
-        item->Accept(&productVisitor);
-    }
 
-    for (auto product : productVisitor.GetProducts())
-    {
-        if (IsIntersecting(product))
-        {
-            mBroken = true;
-            product->SetPassedBeam(true);
-            break;
-        }
-    }
 
-    if (wasBroken != mBroken)
+/**
+ * drive the output pin after Simulation::UpdateBeams has run
+ */
+void Beam::UpdateOutputPin()
+{
+    if (mModel->HasChanged())
     {
-        if (mBroken)
-        {
-            mOutputPin->SetCurrentState(States::Zero); // beam is broken, output is 0
-        }
-        else
-        {
-            mOutputPin->SetCurrentState(States::One); // beam is intact, output is 1
-        }
+        // beam is broken, output is 0; beam is intact, output is 1
+        GetOutputPin()->SetCurrentState(mModel->GetOutputState());
     }
 }
 
+/**
+ * check if the beam is intersecting with a product
+ * 
+ * @param product the product to test
+ * @return true if the beam is intersecting with the product
+ */
 bool Beam::IsIntersecting(const Product* product)
 {
-    const int Padding = 5;
-    double productX = product->GetX();
-    double productY = product->GetY();
-    double productSize = product->GetWidth();
-
-    double x1 = mX - mSenderOffset;
-    double y1 = mY;
-    double x2 = mX;
-    double y2 = mY;
-
-    if (productY - productSize / 2 > y1 + Padding || // product is below beam
-        productY + productSize / 2 < y1 - Padding) // product is above beam
-    {
-        return false;
-    }
-
-    if (productX + productSize / 2 < std::min(x1, x2) ||
-        productX - productSize / 2 > std::max(x1, x2))
-    {
-        return false; // product is to left or right of beam
-    }
-
-    return true; // intersects beam
+    return mModel->IsIntersecting(*product->GetModel());
 }
@@ -10,6 +10,7 @@
 #include "Item.h"
 #include "Product.h"
 #include "PinOutput.h"
+#include "BeamModel.h"
 #include <memory>
 
 /**
@@ -20,42 +21,22 @@ class Beam : public Item
 {
 private:
  /**
-  * x location
+  * simulation state of the beam
   */
-    int mX; ///< x location
- /**
-  * y location
-  */
-    int mY; ///< y location
- /**
-  * x sender offset
-  */
-    int mSenderOffset; ///< x sender offset
- /**
-  * state of beam
-  */
-    bool mBroken = false; ///< state of beam
+    std::shared_ptr<BeamModel> mModel; ///< simulation state of the beam
 
- /**
-  * red bitmap
-  */
-    wxGraphicsBitmap mRedBitmap; ///< red bitmap
- /**
-  * green bitmap
-  */
-    wxGraphicsBitmap mGreenBitmap; ///< green bitmap
  /**
   * red image
   */
-    std::unique_ptr<wxImage> mRedImage; ///< red image
+    ResourceCache::Image mRedImage; ///< red image
  /**
   * green image
   */
-    std::unique_ptr<wxImage> mGreenImage; ///< green image
+    ResourceCache::Image mGreenImage; ///< green image
  /**
-  * use a smart pointer
+  * output pin, in the game's PinPool
   */
-    std::unique_ptr<PinOutput> mOutputPin; ///< Use a smart pointer
+    OutputPinHandle mOutputPin; ///< output pin, in the game's PinPool
 
 public:
  /**
@@ -77,22 +58,37 @@ public:
     void operator=(const Beam&) = delete;
 
     Beam(Game* game, int x, int y, int senderOffset);
+
+    static std::vector<std::wstring> GetImages();
+    ~Beam() override;
     void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
-    void Update(double elpased) override;
+    DamageRegion::Rect GetBounds() const override;
+
+    /**
+     * the look of the beam, which changes when it is broken
+     * @return the look
+     */
+    size_t GetLook() const override { return mModel->IsBroken() ? 1 : 0; }
+
+    /**
+     * @return the phase updating the beam is profiled as
+     */
+    FrameProfiler::Phase GetUpdatePhase() const override { return FrameProfiler::Phase::UpdateBeams; }
+    void UpdateOutputPin();
 
 
 /**
  * check if the beam is broken
  * @return true if the beam is broken
  */
-    bool IsBroken() const { return mBroken; }
+    bool IsBroken() const { return mModel->IsBroken(); }
 
 /**
  * set the beam to broken
  * 
  * @param broken 
  */
-    void SetBroken(bool broken) { mBroken = broken; }
+    void SetBroken(bool broken) { mModel->SetBroken(broken); }
 
 /**
  * check if the beam is intersecting with a product
@@ -102,23 +98,25 @@ public:
  */
     bool IsIntersecting(const Product* product);
 
-    /**
-     * getter for the output pin
-     * @return the output pin
-     */
-    PinOutput* GetOutputPin() const { return mOutputPin.get(); }
+    PinOutput* GetOutputPin() const;
 
     /**
      * getter for x location
      * @return x location
      */
-    int GetX() const { return mX; }
+    int GetX() const { return mModel->GetX(); }
 
     /**
      * getter for y location
      * @return y location
      */
-    int GetY() const { return mY; }
+    int GetY() const { return mModel->GetY(); }
+
+    /**
+     * get the simulation state of this beam
+     * @return the beam model
+     */
+    std::shared_ptr<BeamModel> GetModel() const { return mModel; }
 
 };
 
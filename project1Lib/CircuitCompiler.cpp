@@ -0,0 +1,311 @@
+/**
+ * @file CircuitCompiler.cpp
+ * @author Yeji Lee
+ */
+
+#include "pch.h"
+#include "CircuitCompiler.h"
+#include "Gate.h"
+#include "Sparty.h"
+#include "Sensor.h"
+#include "Beam.h"
+#include "PinPool.h"
+
+/**
+ * rebuild the circuit from the gates and wires in the registry
+ *
+ * @param registry the items of the game
+ * @param pins their pins and the wires between them
+ */
+void CircuitCompiler::Compile(const ItemRegistry& registry, const PinPool& pins)
+{
+    mPins = &pins;
+
+    mCircuit.Clear();
+    mOutputNets.assign(pins.GetNetlist().GetOutputCount(), Circuit::UnconnectedNet);
+    mSources.clear();
+    mGateOutputs.clear();
+    mSinks.clear();
+    mNetPins.assign(1, Netlist::NoPin);
+    mBatch.Clear();
+
+    // gate outputs first, so inputs wired to them find their net
+    for (auto gate : registry.GetGates())
+    {
+        for (auto handle : gate->GetOutputPins())
+        {
+            auto pin = handle.GetSlot();
+            auto net = mCircuit.AddNet();
+            mOutputNets[pin] = net;
+            mGateOutputs.emplace_back(pin, net);
+            mNetPins.push_back(pin);
+        }
+    }
+
+    for (auto gate : registry.GetGates())
+    {
+        gate->Accept(this);
+    }
+
+    for (auto sparty : registry.GetSpartys())
+    {
+        auto pin = sparty->GetInputPin()->GetId();
+        mSinks.emplace_back(pin, InputNet(pin));
+    }
+
+    for (auto sensor : registry.GetSensors())
+    {
+        for (auto& pin : sensor->GetPropertyPins())
+        {
+            auto net = mOutputNets[pin.first->GetId()];
+            if (net != Circuit::UnconnectedNet)
+            {
+                mBatch.AddSensorNet(net, pin.second);
+            }
+        }
+    }
+
+    for (auto beam : registry.GetBeams())
+    {
+        auto net = mOutputNets[beam->GetOutputPin()->GetId()];
+        if (net != Circuit::UnconnectedNet)
+        {
+            mBatch.AddBeamNet(net);
+        }
+    }
+
+    mCircuit.Compile();
+    mDirty = false;
+
+    // the pins may still hold states from the old circuit
+    mWriteAll = true;
+
+    mPins = nullptr;
+}
+
+/**
+ * evaluate the circuit for this tick
+ *
+ * Rebuilds the circuit first if it was invalidated.
+ *
+ * @param registry the items of the game
+ * @param pins their pins and the wires between them
+ */
+void CircuitCompiler::Evaluate(const ItemRegistry& registry, PinPool& pins)
+{
+    if (mDirty)
+    {
+        Compile(registry, pins);
+    }
+
+    for (auto& source : mSources)
+    {
+        auto pin = pins.GetOutput(source.first);
+        auto state = pin->GetCurrentState();
+        if (mCircuit.GetNet(source.second) != state)
+        {
+            mCircuit.SetNet(source.second, state);
+            Push(pin, pins);
+        }
+    }
+
+    if (mCircuit.IsIdle() && !mWriteAll)
+    {
+        return;
+    }
+
+    mCircuit.Propagate();
+
+    if (mWriteAll)
+    {
+        for (auto& output : mGateOutputs)
+        {
+            pins.GetOutput(output.first)->SetCurrentState(mCircuit.GetNet(output.second));
+        }
+
+        // every input pin, in the order they sit in the pool
+        const auto& netlist = pins.GetNetlist();
+        for (auto& input : pins.GetInputs())
+        {
+            auto driver = netlist.GetDriver(input.GetId());
+            input.SetCurrentState(driver != Netlist::NoPin ? pins.GetOutput(driver)->GetCurrentState() : States::Unknown);
+        }
+
+        mWriteAll = false;
+        return;
+    }
+
+    for (auto net : mCircuit.GetChangedNets())
+    {
+        auto pin = pins.GetOutput(mNetPins[net]);
+        pin->SetCurrentState(mCircuit.GetNet(net));
+        Push(pin, pins);
+    }
+}
+
+/**
+ * copy the state of an output pin to the input pins wired to it
+ *
+ * @param pin the output pin
+ * @param pins the pins of the game and the wires between them
+ */
+void CircuitCompiler::Push(const PinOutput* pin, PinPool& pins)
+{
+    for (auto input : pins.GetNetlist().GetFanout(pin->GetId()))
+    {
+        pins.GetInput(input)->SetCurrentState(pin->GetCurrentState());
+    }
+}
+
+/**
+ * find out which products the circuit would have Sparty kick
+ *
+ * Each product is run as if it were in front of the sensors with the
+ * beam broken, all in one pass of the circuit. Every Sparty kicks when
+ * a beam breaks, so a product is kicked if any Sparty's input is One.
+ *
+ * @param registry the items of the game
+ * @param pins their pins and the wires between them
+ * @param products the products
+ * @return bit i % 64 of word i / 64 set if a Sparty's input would be One for products[i]
+ */
+std::vector<uint64_t> CircuitCompiler::PredictKicks(const ItemRegistry& registry, const PinPool& pins,
+                                                    const std::vector<ProductModel*>& products)
+{
+    if (mDirty)
+    {
+        Compile(registry, pins);
+    }
+
+    std::vector<uint32_t> sinks;
+    for (auto& sink : mSinks)
+    {
+        sinks.push_back(sink.second);
+    }
+    return mBatch.Evaluate(mCircuit, products, sinks);
+}
+
+/**
+ * get the net of an output pin, adding it as a source if it is new
+ *
+ * @param pin ID of the output pin
+ * @return its net
+ */
+uint32_t CircuitCompiler::OutputNet(uint32_t pin)
+{
+    if (mOutputNets[pin] != Circuit::UnconnectedNet)
+    {
+        return mOutputNets[pin];
+    }
+
+    // not a gate output, so the beam or sensor it belongs to drives it
+    auto net = mCircuit.AddNet();
+    mOutputNets[pin] = net;
+    mSources.emplace_back(pin, net);
+    mNetPins.push_back(pin);
+    return net;
+}
+
+/**
+ * get the net an input pin reads
+ *
+ * @param pin ID of the input pin
+ * @return the net of the output it is wired to, or Circuit::UnconnectedNet
+ */
+uint32_t CircuitCompiler::InputNet(uint32_t pin)
+{
+    auto driver = mPins->GetNetlist().GetDriver(pin);
+    return driver != Netlist::NoPin ? OutputNet(driver) : Circuit::UnconnectedNet;
+}
+
+/**
+ * add a one or two input gate with a single output
+ *
+ * @param gate the gate
+ * @param op its operation
+ */
+void CircuitCompiler::AddGate(Gate* gate, GateOp op)
+{
+    auto& inputs = gate->GetInputPins();
+    auto a = InputNet(inputs[0].GetSlot());
+    auto b = inputs.size() > 1 ? InputNet(inputs[1].GetSlot()) : Circuit::UnconnectedNet;
+    mCircuit.AddGate(op, a, b, mOutputNets[gate->GetOutputPins()[0].GetSlot()]);
+}
+
+/**
+ * add a flip flop, with Q from the latch and Q' from the inverse op
+ *
+ * The SR flip flop's Q' is always the inverse of Q, so it is a Not of
+ * Q. The D flip flop's Q' is One rather than Unknown when D is
+ * Unknown, so it is latched from D by its own op.
+ *
+ * @param gate the flip flop
+ * @param op SRLatch or DLatch
+ */
+void CircuitCompiler::AddLatch(Gate* gate, GateOp op)
+{
+    AddGate(gate, op);
+
+    auto& outputs = gate->GetOutputPins();
+    auto qBar = mOutputNets[outputs[1].GetSlot()];
+    if (op == GateOp::DLatch)
+    {
+        auto& inputs = gate->GetInputPins();
+        mCircuit.AddGate(GateOp::DLatchInverse, InputNet(inputs[0].GetSlot()), InputNet(inputs[1].GetSlot()), qBar);
+    }
+    else
+    {
+        auto q = mOutputNets[outputs[0].GetSlot()];
+        mCircuit.AddGate(GateOp::Not, q, Circuit::UnconnectedNet, qBar);
+    }
+}
+
+/**
+ * compile an OR gate
+ *
+ * @param orgate the gate
+ */
+void CircuitCompiler::VisitORGate(ORGate* orgate)
+{
+    AddGate(orgate, GateOp::Or);
+}
+
+/**
+ * compile an AND gate
+ *
+ * @param andgate the gate
+ */
+void CircuitCompiler::VisitANDGate(ANDGate* andgate)
+{
+    AddGate(andgate, GateOp::And);
+}
+
+/**
+ * compile a NOT gate
+ *
+ * @param notgate the gate
+ */
+void CircuitCompiler::VisitNOTGate(NOTGate* notgate)
+{
+    AddGate(notgate, GateOp::Not);
+}
+
+/**
+ * compile an SR flip flop
+ *
+ * @param srflip the flip flop
+ */
+void CircuitCompiler::VisitSRFlipFlopGate(SRFlipFlopGate* srflip)
+{
+    AddLatch(srflip, GateOp::SRLatch);
+}
+
+/**
+ * compile a D flip flop
+ *
+ * @param dflip the flip flop
+ */
+void CircuitCompiler::VisitDFlipFlopGate(DFlipFlopGate* dflip)
+{
+    AddLatch(dflip, GateOp::DLatch);
+}
@@ -0,0 +1,97 @@
+/**
+ * @file CircuitCompiler.h
+ * @author Yeji Lee
+ *
+ *
+ */
+
+#ifndef CIRCUITCOMPILER_H
+#define CIRCUITCOMPILER_H
+
+#include <utility>
+#include <vector>
+#include "ItemVisitor.h"
+#include "ItemRegistry.h"
+#include "Circuit.h"
+#include "ScenarioBatch.h"
+
+class PinOutput;
+class PinPool;
+
+/**
+ * turns the gates and wires of the game into a compiled Circuit
+ *
+ * Every output pin becomes a net. Gate output pins are written by the
+ * circuit, other output pins (beams, sensors) are copied into their
+ * nets before each evaluation. The circuit is only rebuilt after
+ * Invalidate. Each tick only the sources whose state changed are fed
+ * in, the circuit propagates just their fan-out, and only the pins of
+ * nets that changed are written back, so an idle tick costs nothing
+ * beyond reading the sources.
+ *
+ * Pins are referred to by their IDs in the game's PinPool, which stay
+ * the same while the pins move around in the pool.
+ */
+class CircuitCompiler : public ItemVisitor
+{
+private:
+    /// the compiled circuit
+    Circuit mCircuit;
+
+    /// does the circuit need to be rebuilt before the next evaluation
+    bool mDirty = true;
+
+    /// net assigned to each output pin ID, UnconnectedNet if none yet
+    std::vector<uint32_t> mOutputNets;
+
+    /// IDs of output pins driven from outside the circuit and their nets
+    std::vector<std::pair<uint32_t, uint32_t>> mSources;
+
+    /// IDs of gate output pins and the nets that drive them
+    std::vector<std::pair<uint32_t, uint32_t>> mGateOutputs;
+
+    /// IDs of input pins outside the circuit that read a net
+    std::vector<std::pair<uint32_t, uint32_t>> mSinks;
+
+    /// output pin ID of each net, unused for UnconnectedNet
+    std::vector<uint32_t> mNetPins;
+
+    /// should every pin be written after the next evaluation
+    bool mWriteAll = true;
+
+    /// pins and wires being compiled, only set during Compile
+    const PinPool* mPins = nullptr;
+
+    /// what the source nets mean, for evaluating products in bulk
+    ScenarioBatch mBatch;
+
+    uint32_t OutputNet(uint32_t pin);
+    uint32_t InputNet(uint32_t pin);
+    void AddGate(Gate* gate, GateOp op);
+    void AddLatch(Gate* gate, GateOp op);
+    void Push(const PinOutput* pin, PinPool& pins);
+
+public:
+    /**
+     * mark the circuit as edited so it is rebuilt before the next evaluation
+     */
+    void Invalidate() { mDirty = true; }
+
+    void Compile(const ItemRegistry& registry, const PinPool& pins);
+    void Evaluate(const ItemRegistry& registry, PinPool& pins);
+    std::vector<uint64_t> PredictKicks(const ItemRegistry& registry, const PinPool& pins,
+                                       const std::vector<ProductModel*>& products);
+
+    /**
+     * @return the compiled circuit
+     */
+    const Circuit& GetCircuit() const { return mCircuit; }
+
+    void VisitORGate(ORGate* orgate) override;
+    void VisitANDGate(ANDGate* andgate) override;
+    void VisitNOTGate(NOTGate* notgate) override;
+    void VisitSRFlipFlopGate(SRFlipFlopGate* srflip) override;
+    void VisitDFlipFlopGate(DFlipFlopGate* dflip) override;
+};
+
+#endif //CIRCUITCOMPILER_H
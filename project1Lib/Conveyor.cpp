@@ -8,8 +8,7 @@
 #include <wx/graphics.h>
 #include <wx/bitmap.h>
 #include "Game.h"
-
-#include "ProductVisitor.h"
+#include "ResourceCache.h"
 
 /// Button rectangles for the start and stop buttons
 const wxRect Conveyor::StartButtonRect(35, 29, 95, 36);
@@ -18,6 +17,25 @@ const wxRect Conveyor::StopButtonRect(35, 87, 95, 36);
 /// Image file for the conveyor background
 const std::wstring conveyorBackImage = L"images/conveyor-back.png";
 
+/// Image file for the belt, drawn twice to scroll
+const std::wstring conveyorBeltImage = L"images/conveyor-belt.png";
+
+/// Image file for the panel while the conveyor runs
+const std::wstring conveyorStartImage = L"images/conveyor-switch-start.png";
+
+/// Image file for the panel while the conveyor is stopped
+const std::wstring conveyorStopImage = L"images/conveyor-switch-stop.png";
+
+
+/**
+ * image files a conveyor loads, so they can be decoded ahead of time
+ *
+ * @return the image files
+ */
+std::vector<std::wstring> Conveyor::GetImages()
+{
+    return {conveyorBackImage, conveyorBeltImage, conveyorStartImage, conveyorStopImage};
+}
 
 /**
  * consturctor for the conveyor
@@ -30,42 +48,24 @@ const std::wstring conveyorBackImage = L"images/conveyor-back.png";
  * @param panelLocation the location of the panel
  */
 Conveyor::Conveyor(Game* game, int x, int y, double speed, int height, const wxPoint& panelLocation)
-    : Item(game, conveyorBackImage),
-      mX(x), mY(y), mSpeed(speed), mHeight(height), mPanelLocation(panelLocation), mIsRunning(false)
+    : Item(game, conveyorBackImage), mPanelLocation(panelLocation)
 {
+    mModel = std::make_shared<ConveyorModel>(x, y, speed, height);
 }
 
 /**
- * updates the conveyor and moves the products
+ * updates the conveyor belt
+ *
+ * The products on the belt are moved here too, all at once, by
+ * ConveyorModel::Update.
  * 
  * @param elapsed the time elapsed
  */
 void Conveyor::Update(double elapsed)
 {
-    if (mIsRunning)
+    if (mModel->Update(elapsed))
     {
-        mBeltOffset += mSpeed * elapsed;
-
-        if (mBeltOffset >= mHeight)
-        {
-            mBeltOffset -= mHeight;
-        }
-
-        MoveProducts(elapsed);
-    }
-}
-
-/**
- * moves the products on the conveyor
- * 
- * @param elapsed the time elapsed
- */
-void Conveyor::MoveProducts(double elapsed)
-{
-    ProductVisitor visitor;
-    for (const auto& item : GetGame()->GetItems())
-    {
-        item->Accept(&visitor);
+        GetGame()->SetState(Game::GameState::Ending);
     }
 }
 
@@ -75,8 +75,7 @@ void Conveyor::MoveProducts(double elapsed)
  */
 void Conveyor::Start()
 {
-    mIsRunning = true;
-    ResetProducts();
+    GetGame()->GetSimulation().StartConveyor(mModel.get());
 }
 
 /**
@@ -85,7 +84,7 @@ void Conveyor::Start()
  */
 void Conveyor::Stop()
 {
-    mIsRunning = false;
+    mModel->Stop();
 }
 
 /**
@@ -94,19 +93,7 @@ void Conveyor::Stop()
  */
 void Conveyor::ResetProducts()
 {
-    ProductVisitor visitor;
-    for (const auto& item : GetGame()->GetItems())
-    {
-        item->Accept(&visitor);
-    }
-
-    for (auto& product : visitor.GetProducts())
-    {
-        if (product->IsOnConveyor(this))
-        {
-            product->ResetPosition();
-        }
-    }
+    GetGame()->GetSimulation().ResetProducts(mModel.get());
 }
 
 /**
@@ -117,25 +104,74 @@ void Conveyor::ResetProducts()
 void Conveyor::Draw(std::shared_ptr<wxGraphicsContext> graphics)
 {
     if (!graphics) return;
-    wxBitmap conveyorBackground(conveyorBackImage, wxBITMAP_TYPE_PNG);
-    graphics->DrawBitmap(conveyorBackground, mX - (conveyorBackground.GetWidth() / 2),
-                         mY - (mHeight / 2), conveyorBackground.GetWidth(), mHeight);
+    int x = GetX();
+    int y = GetY();
+    int height = mModel->GetHeight();
+    double beltOffset = mModel->GetBeltOffset();
+    auto& resources = ResourceCache::Get();
 
     // Draw the conveyor belt twice to create a continuous scrolling effect
-    wxBitmap conveyorBelt(L"images/conveyor-belt.png", wxBITMAP_TYPE_PNG);
-    graphics->DrawBitmap(conveyorBelt, mX - (conveyorBelt.GetWidth() / 2),
-                         mY - (mHeight / 2) + mBeltOffset, conveyorBelt.GetWidth(), mHeight);
-    graphics->DrawBitmap(conveyorBelt, mX - (conveyorBelt.GetWidth() / 2),
-                         mY - (mHeight / 2) + mBeltOffset - mHeight, conveyorBelt.GetWidth(), mHeight);
+    auto conveyorBelt = resources.GetBitmap(graphics.get(), conveyorBeltImage);
+    int beltWidth = resources.GetSize(conveyorBeltImage).GetWidth();
+    graphics->DrawBitmap(conveyorBelt, x - (beltWidth / 2),
+                         y - (height / 2) + beltOffset, beltWidth, height);
+    graphics->DrawBitmap(conveyorBelt, x - (beltWidth / 2),
+                         y - (height / 2) + beltOffset - height, beltWidth, height);
 
     // Draw the control panel based on conveyor state
-    wxBitmap panelBitmap = mIsRunning
-                               ? wxBitmap(L"images/conveyor-switch-start.png", wxBITMAP_TYPE_PNG)
-                               : wxBitmap(L"images/conveyor-switch-stop.png", wxBITMAP_TYPE_PNG);
-    graphics->DrawBitmap(panelBitmap, mX + mPanelLocation.x, mY + mPanelLocation.y,
-                         panelBitmap.GetWidth(), panelBitmap.GetHeight());
+    const auto& panelImage = mModel->IsRunning() ? conveyorStartImage : conveyorStopImage;
+    auto panelSize = resources.GetSize(panelImage);
+    graphics->DrawBitmap(resources.GetBitmap(graphics.get(), panelImage), x + mPanelLocation.x, y + mPanelLocation.y,
+                         panelSize.GetWidth(), panelSize.GetHeight());
+}
+
+/**
+ * draw the conveyor background, which does not move, into the static layer
+ *
+ * @param graphics the graphics context
+ */
+void Conveyor::DrawStatic(std::shared_ptr<wxGraphicsContext> graphics)
+{
+    int height = mModel->GetHeight();
+    auto& resources = ResourceCache::Get();
+
+    int backWidth = resources.GetSize(conveyorBackImage).GetWidth();
+    graphics->DrawBitmap(resources.GetBitmap(graphics.get(), conveyorBackImage), GetX() - (backWidth / 2),
+                         GetY() - (height / 2), backWidth, height);
+}
+
+/**
+ * the area the conveyor draws in, its belt and its panel
+ *
+ * @return the bounds in virtual pixels
+ */
+DamageRegion::Rect Conveyor::GetBounds() const
+{
+    auto& resources = ResourceCache::Get();
+    double x = GetX();
+    double y = GetY();
+    double height = mModel->GetHeight();
+    double halfWidth = std::max(resources.GetSize(conveyorBackImage).GetWidth(),
+                                resources.GetSize(conveyorBeltImage).GetWidth()) / 2.0;
+
+    // the two belt copies reach up to a belt height past either end as it scrolls
+    auto panelSize = resources.GetSize(conveyorStartImage);
+    DamageRegion::Rect belt = {x - halfWidth, y - height * 1.5, x + halfWidth, y + height * 1.5};
+    DamageRegion::Rect panel = {x + mPanelLocation.x, y + mPanelLocation.y,
+                                x + mPanelLocation.x + panelSize.GetWidth(), y + mPanelLocation.y + panelSize.GetHeight()};
+    return belt.Union(panel);
 }
 
+/**
+ * the look of the conveyor, which changes as the belt scrolls and
+ * when it starts or stops
+ *
+ * @return the look
+ */
+size_t Conveyor::GetLook() const
+{
+    return std::hash<double>()(mModel->GetBeltOffset()) * 2 + (mModel->IsRunning() ? 1 : 0);
+}
 
 /**
  * checks if the start button is clicked
@@ -146,8 +182,8 @@ void Conveyor::Draw(std::shared_ptr<wxGraphicsContext> graphics)
  */
 bool Conveyor::CheckStartButtonClick(int mouseX, int mouseY) const
 {
-    wxRect startRect(mX + mPanelLocation.x + StartButtonRect.GetX(),
-                     mY + mPanelLocation.y + StartButtonRect.GetY(),
+    wxRect startRect(GetX() + mPanelLocation.x + StartButtonRect.GetX(),
+                     GetY() + mPanelLocation.y + StartButtonRect.GetY(),
                      StartButtonRect.GetWidth(), StartButtonRect.GetHeight());
     return startRect.Contains(wxPoint(mouseX, mouseY));
 }
@@ -161,8 +197,8 @@ bool Conveyor::CheckStartButtonClick(int mouseX, int mouseY) const
  */
 bool Conveyor::CheckStopButtonClick(int mouseX, int mouseY) const
 {
-    wxRect stopRect(mX + mPanelLocation.x + StopButtonRect.GetX(),
-                    mY + mPanelLocation.y + StopButtonRect.GetY(),
+    wxRect stopRect(GetX() + mPanelLocation.x + StopButtonRect.GetX(),
+                    GetY() + mPanelLocation.y + StopButtonRect.GetY(),
                     StopButtonRect.GetWidth(), StopButtonRect.GetHeight());
     return stopRect.Contains(wxPoint(mouseX, mouseY));
 }
@@ -174,7 +210,7 @@ bool Conveyor::CheckStopButtonClick(int mouseX, int mouseY) const
  */
 int Conveyor::GetX() const
 {
-    return mX;
+    return mModel->GetX();
 }
 
 /**
@@ -184,7 +220,7 @@ int Conveyor::GetX() const
  */
 int Conveyor::GetY() const
 {
-    return mY;
+    return mModel->GetY();
 }
 
 /**
@@ -194,7 +230,7 @@ int Conveyor::GetY() const
  */
 double Conveyor::GetSpeed() const
 {
-    return mSpeed;
+    return mModel->GetSpeed();
 }
 
 /**
@@ -204,5 +240,5 @@ double Conveyor::GetSpeed() const
  */
 bool Conveyor::IsRunning() const
 {
-    return mIsRunning;
+    return mModel->IsRunning();
 }
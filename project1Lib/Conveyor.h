@@ -10,6 +10,7 @@
 #include <string>
 #include "Item.h"
 #include "Product.h"
+#include "ConveyorModel.h"
 
 /// Height of the conveyor
 const int ConveyorHeight = 800;
@@ -22,32 +23,23 @@ const int ConveyorHeight = 800;
 class Conveyor : public Item
 {
 private:
-    int mX; ///< X position of the conveyor
-    int mY; ///< Y position of the conveyor
-    int mHeight; ///< Height of the conveyor
-    int mWidth = 800; ///< Width of the conveyor
-
-    /// Speed of the conveyor
-    double mSpeed;
+    /// Simulation state of the conveyor
+    std::shared_ptr<ConveyorModel> mModel;
 
     /// Panel location based on conveyor position
     wxPoint mPanelLocation;
 
-    /// If the conveyor is running
-    bool mIsRunning;
-
     /// Define button rectangles for the start and stop buttons
     static const wxRect StartButtonRect;
 
     /// Define button rectangles for the start and stop buttons
     static const wxRect StopButtonRect;
 
-    /// offset of the belt
-    double mBeltOffset = 0;
-
 public:
     Conveyor(Game* game, int x, int y, double speed, int height, const wxPoint& panelLocation);
 
+    static std::vector<std::wstring> GetImages();
+
 
     /**
      * accepts a visitor
@@ -65,8 +57,6 @@ public:
 
     void Update(double elapsed);
 
-    void MoveProducts(double elapsed);
-
     // Starts the conveyor and resets the products' positions
     void Start();
 
@@ -78,6 +68,14 @@ public:
 
     // Draws the conveyor and its panel
     void Draw(std::shared_ptr<wxGraphicsContext> graphics);
+    void DrawStatic(std::shared_ptr<wxGraphicsContext> graphics) override;
+    DamageRegion::Rect GetBounds() const override;
+    size_t GetLook() const override;
+
+    /**
+     * @return the phase updating the conveyor is profiled as
+     */
+    FrameProfiler::Phase GetUpdatePhase() const override { return FrameProfiler::Phase::UpdateConveyors; }
 
     // Checks if the Start button or Stop button is clicked
     bool CheckStartButtonClick(int mouseX, int mouseY) const;
@@ -88,6 +86,13 @@ public:
     int GetY() const;
     double GetSpeed() const;
     bool IsRunning() const;
+
+    /**
+     * get the simulation state of this conveyor
+     *
+     * @return the conveyor model
+     */
+    std::shared_ptr<ConveyorModel> GetModel() const { return mModel; }
 };
 
 #endif // CONVEYOR_H
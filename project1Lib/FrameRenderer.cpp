@@ -0,0 +1,35 @@
+/**
+ * @file FrameRenderer.cpp
+ * @author Yeji Lee
+ */
+
+#include "pch.h"
+#include "FrameRenderer.h"
+#include "Game.h"
+
+/**
+ * constructor
+ * @param width frame width in pixels
+ * @param height frame height in pixels
+ */
+FrameRenderer::FrameRenderer(int width, int height) : mImage(width, height)
+{
+}
+
+/**
+ * draw a frame of the game
+ *
+ * The whole frame is drawn, as for a window that was just exposed.
+ *
+ * @param game the game
+ * @return the frame, valid until the next one is rendered
+ */
+const wxImage& FrameRenderer::Render(Game& game)
+{
+    {
+        // the image is written when the context is destroyed
+        auto graphics = std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create(mImage));
+        game.OnDraw(graphics, mImage.GetWidth(), mImage.GetHeight());
+    }
+    return mImage;
+}
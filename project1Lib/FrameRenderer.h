@@ -0,0 +1,37 @@
+/**
+ * @file FrameRenderer.h
+ * @author Yeji Lee
+ *
+ * Draws a game into an image, with no window.
+ */
+
+#ifndef FRAMERENDERER_H
+#define FRAMERENDERER_H
+
+class Game;
+
+/**
+ * renders frames of a game offscreen
+ *
+ * Game::OnDraw draws into a wxImage of a fixed size through a graphics
+ * context made for the image, exactly as GameView draws it into a
+ * window of that size, so frames can be saved, compared against
+ * golden images or timed without a top-level window or paint event.
+ */
+class FrameRenderer
+{
+private:
+    wxImage mImage; ///< the latest frame
+
+public:
+    FrameRenderer(int width, int height);
+
+    const wxImage& Render(Game& game);
+
+    /**
+     * @return the latest frame, black before the first
+     */
+    const wxImage& GetImage() const { return mImage; }
+};
+
+#endif //FRAMERENDERER_H
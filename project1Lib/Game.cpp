@@ -15,18 +15,15 @@
 #include "Pins.h"
 #include "PinInput.h"
 #include "Wire.h"
-#include <unordered_map>
-#include <unordered_set>
-#include <stack>
 
-#include "BeamVisitor.h"
 #include "GateVisitor.h"
-#include "ProductVisitor.h"
 #include "WireVisitor.h"
-#include "SpartyVisitor.h"
+#include "SimulationVisitor.h"
+#include "ItemRegistryVisitor.h"
+#include "Sparty.h"
 
-/// border for the game to make it black
-const int BigNumberBorder = 2000;
+/// Width of the wires between pins
+const int WireWidth = 3;
 
 /**
  * Constructor
@@ -49,52 +46,249 @@ void Game::Load(const wxString& filename)
 
 /**
  * Start a specific level.
+ *
+ * Once the level is loaded, the level after it is parsed and its
+ * images decoded on a worker thread while this one is played, so
+ * StartNextLevel finds it ready.
  * 
  * @param levelNumber the level number
  */
 void Game::StartLevel(int levelNumber)
 {
-    std::wstring levelFile = L"levels/level" + std::to_wstring(levelNumber) + L".xml";
-    Load(levelFile);
+    // the worker may still be parsing this very level
+    if (mPrefetch.valid())
+    {
+        mPrefetch.wait();
+    }
+
+    mCurrentLevel = levelNumber;
+    Load(GetLevelPath(levelNumber));
+
+    mPrefetch = std::async(std::launch::async, &XMLParser::Prefetch, GetLevelPath(levelNumber + 1));
+}
+
+/**
+ * Get the file a level is loaded from.
+ *
+ * @param levelNumber the level number
+ * @return the level file
+ */
+wxString Game::GetLevelPath(int levelNumber)
+{
+    return wxString::Format(L"levels/level%d.xml", levelNumber);
 }
 
 void Game::AddWire(PinOutput* outputPin, PinInput* inputPin)
 {
-    //inputPin->SetConnection(outputPin);
-    inputPin->ConnectToOutput(outputPin);
-    outputPin->ConnectToInput(inputPin);
+    mPins.Connect(outputPin, inputPin);
+    mCircuit.Invalidate();
 }
 
 /**
- * used for topological sort of the gates
- * 
- * @param gate  the gate
- * @param visited  the visited set
- * @param Stack  the stack
+ * Remove a wire from the game.
+ *
+ * @param outputPin the output pin
+ * @param inputPin the input pin
+ */
+void Game::RemoveWire(PinOutput* outputPin, PinInput* inputPin)
+{
+    mPins.Disconnect(outputPin, inputPin);
+    mCircuit.Invalidate();
+}
+
+/**
+ * Test if a point is on an output pin of any item.
+ *
+ * @param x x axis
+ * @param y y axis
+ * @return the pin, nullptr if there is none
+ */
+PinOutput* Game::HitTestOutputPin(double x, double y)
+{
+    for (auto& pin : mPins.GetOutputs())
+    {
+        if (pin.HitTest(x, y))
+        {
+            return &pin;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Test if a point is on an input pin of any item.
+ *
+ * @param x x axis
+ * @param y y axis
+ * @return the pin, nullptr if there is none
+ */
+PinInput* Game::HitTestInputPin(double x, double y)
+{
+    for (auto& pin : mPins.GetInputs())
+    {
+        if (pin.HitTest(x, y))
+        {
+            return &pin;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * draw the wires between the pins
+ *
+ * Each wire's curve is flattened once and again only when one of its
+ * pins moves. The wires are gathered into a path per state, so a frame
+ * costs a pen and a stroke for each state however many wires there are.
+ *
+ * @param graphics the graphics context to draw on
+ * @param visible the part of the game being drawn, in virtual pixels
+ */
+void Game::DrawWires(std::shared_ptr<wxGraphicsContext> graphics, const DamageRegion::Rect& visible)
+{
+    // a path for each of States::Zero, States::One and States::Unknown
+    wxGraphicsPath paths[] = {graphics->CreatePath(), graphics->CreatePath(), graphics->CreatePath()};
+
+    const auto& netlist = mPins.GetNetlist();
+    for (auto& output : mPins.GetOutputs())
+    {
+        auto state = output.GetCurrentState();
+        auto& path = paths[state == States::Zero ? 0 : state == States::One ? 1 : 2];
+        for (auto input : netlist.GetFanout(output.GetId()))
+        {
+            auto& curve = UpdateWire(output, input).mCurve;
+            if (!visible.Touches(curve.GetBounds(WireWidth)))
+            {
+                continue;
+            }
+
+            const auto& points = curve.GetPoints();
+            path.MoveToPoint(points[0].mX, points[0].mY);
+            for (size_t i = 1; i < points.size(); i++)
+            {
+                path.AddLineToPoint(points[i].mX, points[i].mY);
+            }
+        }
+    }
+
+    const wxColour* colours[] = {&PinOutput::GetConnectionColorZero(), &PinOutput::GetConnectionColorOne(),
+                                 &PinOutput::GetConnectionColorUnknown()};
+    for (int i = 0; i < 3; i++)
+    {
+        graphics->SetPen(wxPen(*colours[i], WireWidth));
+        graphics->StrokePath(paths[i]);
+    }
+}
+
+/**
+ * get a wire, flattening its curve again if either pin moved
+ *
+ * @param output the output pin
+ * @param input id of the input pin
+ * @return the wire
  */
-void topologicalSortUtil(Gate* gate, std::unordered_set<Gate*>& visited, std::stack<Gate*>& Stack)
+Game::DrawnWire& Game::UpdateWire(PinOutput& output, uint32_t input)
 {
-    visited.insert(gate);
+    auto& wire = mWires[{output.GetId(), input}];
+    auto inputPin = mPins.GetInput(input);
+    wire.mCurve.SetEnds(output.GetX(), output.GetY(), inputPin->GetX(), inputPin->GetY());
+    return wire;
+}
 
-    for (auto& inputPin : gate->GetInputPins())
+/**
+ * add the wires that changed since damage was last collected
+ *
+ * A wire is damaged where it was and where it is now when either end
+ * moved or its state changed, and where it was when it is removed.
+ */
+void Game::CollectWireDamage()
+{
+    for (auto& wire : mWires)
     {
-        if (inputPin.HasConnection())
+        wire.second.mSeen = false;
+    }
+
+    const auto& netlist = mPins.GetNetlist();
+    for (auto& output : mPins.GetOutputs())
+    {
+        auto state = output.GetCurrentState();
+        for (auto input : netlist.GetFanout(output.GetId()))
         {
-            auto connectedGate = inputPin.GetConnectedGate();
-            if (connectedGate && visited.find(connectedGate) == visited.end())
+            auto& wire = UpdateWire(output, input);
+            auto bounds = wire.mCurve.GetBounds(WireWidth);
+            if (wire.mBounds != bounds || wire.mState != state)
             {
-                topologicalSortUtil(connectedGate, visited, Stack);
+                mDamage.Add(wire.mBounds);
+                mDamage.Add(bounds);
+                wire.mBounds = bounds;
+                wire.mState = state;
             }
+            wire.mSeen = true;
+        }
+    }
+
+    for (auto wire = mWires.begin(); wire != mWires.end();)
+    {
+        if (wire->second.mSeen)
+        {
+            ++wire;
         }
+        else
+        {
+            mDamage.Add(wire->second.mBounds);
+            wire = mWires.erase(wire);
+        }
+    }
+}
+
+/**
+ * collect the areas of the game that changed since this was last called
+ *
+ * @return the areas, in virtual pixels, that need drawing again
+ */
+DamageRegion Game::CollectDamage()
+{
+    for (const auto& item : mItems)
+    {
+        item->CollectDamage(mDamage);
     }
+    CollectWireDamage();
 
-    Stack.push(gate);
+    DamageRegion damage = mDamage;
+    mDamage.Clear();
+    return damage;
 }
 
+/**
+ * Compute the outputs of the gates.
+ *
+ * Runs the compiled circuit, which is rebuilt first if gates or
+ * wires have changed since it was last compiled.
+ */
 void Game::ComputeGateOutputs()
 {
-    GateComputeOutputVisitor computeVisitor;
-    Accept(&computeVisitor);
+    ScopedTimer timer(FrameProfiler::Get(), FrameProfiler::Phase::Circuit);
+    mCircuit.Evaluate(mRegistry, mPins);
+}
+
+/**
+ * check if the circuit as wired kicks exactly the products that
+ * should be kicked, without playing the level
+ *
+ * Every product is run through the circuit in one pass, one scenario
+ * each.
+ *
+ * @return true if every product in the level would be sorted correctly
+ */
+bool Game::CircuitSortsProducts()
+{
+    std::vector<ProductModel*> products;
+    for (const auto& product : mSimulation.GetProducts())
+    {
+        products.push_back(product.get());
+    }
+
+    return mCircuit.PredictKicks(mRegistry, mPins, products) == ScenarioBatch::KickMask(products);
 }
 
 /**
@@ -104,51 +298,50 @@ void Game::ComputeGateOutputs()
  */
 void Game::Update(double elapsed)
 {
+    auto& profiler = FrameProfiler::Get();
+    ScopedTimer timer(profiler, FrameProfiler::Phase::Update);
+
     //---- DO NOT REMOVE THIS
     for (auto& item : mItems)
     {
+        ScopedTimer itemTimer(profiler, item->GetUpdatePhase());
         item->Update(elapsed);
     }
     //---- DO NOT REMOVE THIS
 
-    BeamVisitor beamVisitor;
-    for (const auto& item : mItems)
+    mSimulation.UpdateBeams();
+    for (auto beam : mRegistry.GetBeams())
     {
-        item->Accept(&beamVisitor);
+        beam->UpdateOutputPin();
     }
 
-    bool anyBeamBroken = false;
-    const auto& beams = beamVisitor.GetBeams();
-    for (auto beam : beams)
-    {
-        if (beam->IsBroken())
-        {
-            anyBeamBroken = true;
-            break;
-        }
-    }
+    ComputeGateOutputs();
 
-    if (anyBeamBroken)
+    if (mSimulation.AnyBeamBroken())
     {
-        SpartyVisitor spartyVisitor;
-        for (const auto& item : mItems)
-        {
-            item->Accept(&spartyVisitor);
-        }
-
-        const auto& spartys = spartyVisitor.GetSpartys();
-        for (auto sparty : spartys)
+        for (auto sparty : mRegistry.GetSpartys())
         {
             sparty->Kick();
         }
     }
+}
 
-    ProductVisitor productVisitor;
-    for (const auto& item : mItems)
+/**
+ * advance the game by a frame's worth of wall clock time
+ *
+ * The time is run as whole FixedTimestep ticks, so the game always
+ * sees the same step size and the same inputs give the same result.
+ * Any time left over carries to the next frame.
+ *
+ * @param elapsed wall clock time since the last frame in seconds
+ */
+void Game::Advance(double elapsed)
+{
+    int ticks = mTimestep.Advance(elapsed);
+    for (int i = 0; i < ticks; i++)
     {
-        item->Accept(&productVisitor);
+        Update(FixedTimestep::TickDuration);
     }
-    const auto& products = productVisitor.GetProducts();
 }
 
 /**
@@ -193,8 +386,9 @@ void Game::HandleMouseMove(int x, int y, wxMouseEvent& event)
  * @param graphics 
  * @param width 
  * @param height 
+ * @param clip the part of the window to draw, in device pixels, all of it if empty
  */
-void Game::OnDraw(std::shared_ptr<wxGraphicsContext> graphics, int width, int height)
+void Game::OnDraw(std::shared_ptr<wxGraphicsContext> graphics, int width, int height, const wxRect& clip)
 {
     // Define the virtual game area dimensions (pixelWidth and pixelHeight) for scaling calculations
     double pixelWidth = mVirtualWidth;
@@ -211,48 +405,105 @@ void Game::OnDraw(std::shared_ptr<wxGraphicsContext> graphics, int width, int he
     mXOffset = (width - pixelWidth * mScale) / 2.0;
     mYOffset = (height - pixelHeight * mScale) / 2.0;
 
-    // Set the initial graphics state and apply translation and scaling
+    auto& profiler = FrameProfiler::Get();
+
+    // the static layers are drawn once for each level and window size
+    {
+        ScopedTimer timer(profiler, FrameProfiler::Phase::DrawStatic);
+        if (!mStaticLayer.IsOk() || mStaticSize != wxSize(width, height))
+        {
+            DrawStaticLayer(width, height);
+        }
+
+        if (graphics->GetRenderer() != mStaticRenderer)
+        {
+            mStaticBitmap = graphics->CreateBitmapFromImage(mStaticLayer);
+            mStaticRenderer = graphics->GetRenderer();
+        }
+    }
+
+    // Set the initial graphics state
     graphics->PushState();
+
+    // only the part of the game in the clip is drawn again, in virtual pixels
+    DamageRegion::Rect visible = DamageRegion::Everything;
+    if (!clip.IsEmpty())
+    {
+        graphics->Clip(clip.GetX(), clip.GetY(), clip.GetWidth(), clip.GetHeight());
+        visible = {(clip.GetLeft() - mXOffset) / mScale, (clip.GetTop() - mYOffset) / mScale,
+                   (clip.GetRight() + 1 - mXOffset) / mScale, (clip.GetBottom() + 1 - mYOffset) / mScale};
+    }
+
+    {
+        ScopedTimer timer(profiler, FrameProfiler::Phase::DrawStatic);
+        graphics->DrawBitmap(mStaticBitmap, 0, 0, width, height);
+    }
+
+    // apply translation and scaling
     graphics->Translate(mXOffset, mYOffset); // Centering offset
     graphics->Scale(mScale, mScale); // Apply scaling for consistent sizing
 
-    // Draw the background color for the entire virtual game area
-    wxBrush background(wxColour(230, 255, 230)); // Light green background
-    graphics->SetBrush(background);
-    graphics->DrawRectangle(0, 0, pixelWidth, pixelHeight); // Fill the virtual area
-
+    // nothing is drawn over the black border outside of the view
+    graphics->Clip(0, 0, pixelWidth, pixelHeight);
 
     /// WE ARE ONLY ALLOW TO HAVE ONE LIST  https://cse335.egr.msu.edu/project1-fs24/description.php read Rules and Requirements
-    // Draw each item in the game (e.g., products, obstacles) with the applied scaling
-    for (const auto& item : mItems)
+    // Draw the parts of each item in the game that change with the applied scaling
     {
-        item->Draw(graphics);
+        ScopedTimer timer(profiler, FrameProfiler::Phase::DrawItems);
+        for (const auto& item : mItems)
+        {
+            if (visible.Touches(item->GetBounds()))
+            {
+                item->Draw(graphics);
+            }
+        }
     }
 
-    WireDrawingVisitor wireVisitor(graphics.get(), mShowControlPoints);
-    Accept(&wireVisitor);
-
-
-    // for drawing the black box outside of the view
-    graphics->SetBrush(wxBrush(*wxBLACK));
-    graphics->SetPen(wxPen(*wxBLACK));
+    {
+        ScopedTimer timer(profiler, FrameProfiler::Phase::DrawWires);
+        DrawWires(graphics, visible);
+    }
 
-    graphics->DrawRectangle(-BigNumberBorder, 0, BigNumberBorder - 1,
-                            BigNumberBorder);
+    // Restore the original graphics state to avoid affecting subsequent draws
+    graphics->PopState();
+}
 
-    graphics->DrawRectangle(pixelWidth + 1, 0, BigNumberBorder, BigNumberBorder);
 
-    graphics->DrawRectangle(0, -BigNumberBorder, BigNumberBorder,
-                            BigNumberBorder - 1);
+/**
+ * draw the layers of the game that do not change during play
+ *
+ * The background, the black border around the view and the static
+ * parts of every item are drawn into mStaticLayer, which OnDraw copies
+ * to the window before drawing the rest. It is an image rather than
+ * a bitmap so that drawing it needs no display.
+ *
+ * @param width window width
+ * @param height window height
+ */
+void Game::DrawStaticLayer(int width, int height)
+{
+    // a new image is black, the border outside of the view
+    mStaticLayer = wxImage(std::max(width, 1), std::max(height, 1));
+    mStaticSize = wxSize(width, height);
+    mStaticRenderer = nullptr;
 
-    graphics->DrawRectangle(0, pixelHeight + 1, BigNumberBorder, BigNumberBorder);
+    // the image is written when the context is destroyed, at the end of this function
+    auto graphics = std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create(mStaticLayer));
+    graphics->Translate(mXOffset, mYOffset);
+    graphics->Scale(mScale, mScale);
 
+    // Draw the background color for the entire virtual game area
+    wxBrush background(wxColour(230, 255, 230)); // Light green background
+    graphics->SetBrush(background);
+    graphics->DrawRectangle(0, 0, mVirtualWidth, mVirtualHeight);
 
-    // Restore the original graphics state to avoid affecting subsequent draws
-    graphics->PopState();
+    graphics->Clip(0, 0, mVirtualWidth, mVirtualHeight);
+    for (const auto& item : mItems)
+    {
+        item->DrawStatic(graphics);
+    }
 }
 
-
 /**
  * Add an item to the game.
  * 
@@ -261,6 +512,15 @@ void Game::OnDraw(std::shared_ptr<wxGraphicsContext> graphics, int width, int he
 void Game::AddItem(std::shared_ptr<Item> item)
 {
     mItems.push_back(item);
+    mStaticLayer = wxNullImage;
+
+    ItemRegistryVisitor registryVisitor(&mRegistry);
+    item->Accept(&registryVisitor);
+
+    SimulationVisitor simulationVisitor(&mSimulation);
+    item->Accept(&simulationVisitor);
+
+    mCircuit.Invalidate();
 }
 
 /**
@@ -302,9 +562,14 @@ std::shared_ptr<Item> Game::HitTest(int x, int y)
  */
 std::shared_ptr<Item> Game::HitTestGate(double x, double y)
 {
-    GateHitTestVisitor hitTestVisitor(x, y);
-    Accept(&hitTestVisitor);
-    Gate* hitGate = hitTestVisitor.GetHitGate();
+    Gate* hitGate = nullptr;
+    for (auto gate : mRegistry.GetGates())
+    {
+        if (gate->HitTest(x, y))
+        {
+            hitGate = gate;
+        }
+    }
     if (hitGate)
     {
         for (const auto& gate : mItems)
@@ -323,16 +588,23 @@ std::shared_ptr<Item> Game::HitTestGate(double x, double y)
  */
 void Game::Clear()
 {
+    // the items return their pins, and with them the wires, to mPins
     mItems.clear();
+    mGrabbedItem = nullptr;
+    mRegistry.Clear();
+    mSimulation.Clear();
+    mTimestep.Reset();
+    mCircuit.Invalidate();
+    mWires.clear();
+    mDamage.AddAll();
+    mStaticLayer = wxNullImage;
 }
 
 
 void Game::StartNextLevel()
 {
-    mCurrentLevel += 1;
-    std::wstring nextLevelFile = L"levels/level" + std::to_wstring(mCurrentLevel) + L".xml";
     Clear();
-    Load(nextLevelFile);
+    StartLevel(mCurrentLevel + 1);
 }
 
 
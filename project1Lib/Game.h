@@ -9,12 +9,21 @@
 #define GAME_H
 
 #include <vector>
+#include <map>
 #include <memory>
+#include <future>
 #include "Gate.h"
 #include "Conveyor.h"
 #include "Beam.h"
 #include "Team.h"
 #include "ItemVisitor.h"
+#include "Simulation.h"
+#include "ItemRegistry.h"
+#include "FixedTimestep.h"
+#include "CircuitCompiler.h"
+#include "PinPool.h"
+#include "DamageRegion.h"
+#include "WireCurve.h"
 
 /**
  * class for the game
@@ -30,13 +39,23 @@ public:
 
     void Load(const wxString& filename);
     void StartLevel(int Number);
+    static wxString GetLevelPath(int levelNumber);
 
     /**
      * Compute the outputs of the gates.
      * 
      */
     void ComputeGateOutputs();
+
+    /**
+     * Note that gates or wires changed, so the circuit is
+     * recompiled before it is next evaluated.
+     */
+    void InvalidateCircuit() { mCircuit.Invalidate(); }
+
+    bool CircuitSortsProducts();
     void Update(double elapsed);
+    void Advance(double elapsed);
 
     void AddItem(std::shared_ptr<Item> item);
     void AddGate(std::shared_ptr<Gate> gate);
@@ -44,8 +63,9 @@ public:
     void HandleMouseClick(wxMouseEvent& event);
     void HandleMouseMove(int x, int y, wxMouseEvent& event);
     std::shared_ptr<Item> HitTest(int x, int y);
-    void OnDraw(std::shared_ptr<wxGraphicsContext> graphics, int width, int height);
+    void OnDraw(std::shared_ptr<wxGraphicsContext> graphics, int width, int height, const wxRect& clip = wxRect());
     void Clear();
+    DamageRegion CollectDamage();
 
 
     /**
@@ -87,6 +107,9 @@ public:
  * @param inputPin the input pin
  */
     void AddWire(PinOutput* outputPin, PinInput* inputPin);
+    void RemoveWire(PinOutput* outputPin, PinInput* inputPin);
+    PinOutput* HitTestOutputPin(double x, double y);
+    PinInput* HitTestInputPin(double x, double y);
 
     /**
      * sets the show control points
@@ -183,12 +206,58 @@ public:
  */
     void StartNextLevel();
 
+    /**
+     * gets the simulation state of the level
+     *
+     * @return Simulation&
+     */
+    Simulation& GetSimulation() { return mSimulation; }
+
+    /**
+     * gets the per-kind indexes of the items
+     *
+     * @return const ItemRegistry&
+     */
+    const ItemRegistry& GetRegistry() const { return mRegistry; }
+
+    /**
+     * gets the fixed timestep accumulator
+     *
+     * @return const FixedTimestep&
+     */
+    const FixedTimestep& GetTimestep() const { return mTimestep; }
+
+    /**
+     * gets the compiled gate circuit
+     *
+     * @return const Circuit&
+     */
+    const Circuit& GetCircuit() const { return mCircuit.GetCircuit(); }
+
+    /**
+     * gets the wires between the pins of the items
+     *
+     * @return const Netlist&
+     */
+    const Netlist& GetNetlist() const { return mPins.GetNetlist(); }
+
+    /**
+     * gets the pins of the items, which the items allocate and release
+     *
+     * @return PinPool&
+     */
+    PinPool& GetPins() { return mPins; }
+
 private:
+    void DrawWires(std::shared_ptr<wxGraphicsContext> graphics, const DamageRegion::Rect& visible);
+    void DrawStaticLayer(int width, int height);
+    void CollectWireDamage();
+
     double mVirtualWidth; ///< Virtual width
     double mVirtualHeight; ///< Virtual height
-    double mScale; ///< Scale
-    double mXOffset; ///< X offset
-    double mYOffset; ///< Y offset
+    double mScale = 0; ///< Scale, 0 until the game is first drawn
+    double mXOffset = 0; ///< X offset
+    double mYOffset = 0; ///< Y offset
     std::wstring mImagesDirectory; ///<directory for images
 
     double mPassTimer = 0; ///< Timer for passing the level
@@ -196,12 +265,55 @@ private:
     int mCurrentLevel = 0; ///< current level
 
 
+    /// parse of the next level running on a worker thread
+    std::future<void> mPrefetch;
+
+    /// pins of the items and the wires between them, declared before
+    /// mItems so it outlives the items that release their pins into it
+    PinPool mPins;
+
     std::vector<std::shared_ptr<Item>> mItems; ///< vector of items
 
+    ItemRegistry mRegistry; ///< items of mItems indexed by kind
+
+    Simulation mSimulation; ///< simulation state shared with the items
+
+    FixedTimestep mTimestep; ///< turns frame time into fixed logic ticks
+
+    CircuitCompiler mCircuit; ///< the gates and wires compiled for evaluation
+
     std::shared_ptr<Item> mGrabbedItem = nullptr; ///< the item that is being moved by the mouse
 
     bool mShowControlPoints = false; ///< Show control points
 
+    /// a wire's flattened curve, and the wire as it was when damage was last collected
+    struct DrawnWire
+    {
+        WireCurve mCurve; ///< the curve between the pins
+        DamageRegion::Rect mBounds; ///< where it was drawn
+        States mState = States::Unknown; ///< the state it was drawn in
+        bool mSeen = false; ///< still wired at the latest collection
+    };
+
+    /// wires by output and input pin id
+    std::map<std::pair<uint32_t, uint32_t>, DrawnWire> mWires;
+
+    DrawnWire& UpdateWire(PinOutput& output, uint32_t input);
+
+    DamageRegion mDamage; ///< areas changed since damage was last collected
+
+    /// the background, borders and static parts of the items, drawn for
+    /// the window size mStaticSize; invalid when the items change
+    wxImage mStaticLayer;
+
+    wxSize mStaticSize; ///< window size mStaticLayer was drawn for
+
+    /// mStaticLayer converted for mStaticRenderer
+    wxGraphicsBitmap mStaticBitmap;
+
+    /// renderer mStaticBitmap belongs to, nullptr if not converted yet
+    wxGraphicsRenderer* mStaticRenderer = nullptr;
+
     Team mTeam; ///< team object
 
     /// Ready state
@@ -13,9 +13,11 @@
 #include "Gate.h"
 #include "Scoreboard.h"
 #include "Beam.h"
-#include "ConveyorVisitor.h"
+#include "Conveyor.h"
 #include "GateVisitor.h"
 #include "Product.h"
+#include "TextCache.h"
+#include "FrameProfiler.h"
 
 using namespace std;
 
@@ -25,6 +27,27 @@ const int NoticeSize = 100;
 /// Color to draw the level notices
 const auto LevelNoticeColor = wxColour(0, 100, 0);
 
+/// Style of the level notices
+const TextCache::Style NoticeStyle = {NoticeSize, false, wxFONTFAMILY_SWISS, L"", true, LevelNoticeColor};
+
+/// Milliseconds between redraws. The game logic ticks on its own fixed step.
+const int FrameInterval = 16;
+
+/// Device pixels repainted around each damaged area
+const int DamageMargin = 2;
+
+/// Frames between updates of the profiler overlay and status bar
+const int ProfilerReadoutFrames = 15;
+
+/// Style of the profiler overlay, in device pixels
+const TextCache::Style ProfilerStyle = {12, true, wxFONTFAMILY_TELETYPE, L"", false, *wxWHITE};
+
+/// Background of the profiler overlay
+const auto ProfilerBackground = wxColour(0, 0, 0, 192);
+
+/// Device pixels between the profiler overlay, its text and the window edge
+const int ProfilerPadding = 6;
+
 /**
  * Constructor for GameView.
  */
@@ -38,6 +61,8 @@ GameView::GameView() : mCurrentLevel(0)
  */
 void GameView::Initialize(wxFrame* mainFrame)
 {
+    mMainFrame = mainFrame;
+
     Create(mainFrame, wxID_ANY,
            wxDefaultPosition, wxDefaultSize,
            wxFULL_REPAINT_ON_RESIZE);
@@ -65,11 +90,11 @@ void GameView::Initialize(wxFrame* mainFrame)
     Bind(wxEVT_MOTION, &GameView::OnMouseMove, this);
 
     // Load the initial level (default to mCurrentLevel)
-    mGame.Load(wxString::Format("levels/level%d.xml", mCurrentLevel));
+    mGame.StartLevel(mCurrentLevel);
 
     Bind(wxEVT_TIMER, &GameView::OnTimer, this);
     mTimer.SetOwner(this);
-    mTimer.Start(60);
+    mTimer.Start(FrameInterval);
     mStopWatch.Start();
 }
 
@@ -79,55 +104,44 @@ void GameView::Initialize(wxFrame* mainFrame)
  */
 void GameView::OnLevelOption(wxCommandEvent& event)
 {
-    wxString filename;
     int levelNumber = 0;
 
     // Switch based on the selected level
     switch (event.GetId())
     {
     case IDM_LEVEL0:
-        filename = L"levels/level0.xml";
         levelNumber = 0;
         break;
     case IDM_LEVEL1:
-        filename = L"levels/level1.xml";
         levelNumber = 1;
         break;
     case IDM_LEVEL2:
-        filename = L"levels/level2.xml";
         levelNumber = 2;
         break;
     case IDM_LEVEL3:
-        filename = L"levels/level3.xml";
         levelNumber = 3;
         break;
     case IDM_LEVEL4:
-        filename = L"levels/level4.xml";
         levelNumber = 4;
         break;
     case IDM_LEVEL5:
-        filename = L"levels/level5.xml";
         levelNumber = 5;
         break;
     case IDM_LEVEL6:
-        filename = L"levels/level6.xml";
         levelNumber = 6;
         break;
     case IDM_LEVEL7:
-        filename = L"levels/level7.xml";
         levelNumber = 7;
         break;
     case IDM_LEVEL8:
-        filename = L"levels/level8.xml";
         levelNumber = 8;
         break;
     }
 
-    // Reload the game with the selected level
+    // Reload the game with the selected level, forgetting any pin of the old one
+    mSelectedOutputPin = OutputPinHandle();
     mGame = Game();
-    mGame.Load(filename);
-
-    mGame.SetCurrentLevel(levelNumber);
+    mGame.StartLevel(levelNumber);
 
     // Request a repaint to reflect the loaded level
     Refresh();
@@ -141,13 +155,13 @@ void GameView::OnLevelOption(wxCommandEvent& event)
  */
 void GameView::OnPaint(wxPaintEvent& event)
 {
+    auto& profiler = FrameProfiler::Get();
+    ScopedTimer timer(profiler, FrameProfiler::Phase::Paint);
+
     // Create a double-buffered display context
     wxAutoBufferedPaintDC dc(this);
 
-    // Clear the display to black
-    wxBrush background(*wxBLACK);
-    dc.SetBackground(background);
-    dc.Clear();
+    // the game's static layer covers the whole window, so it is not cleared first
 
     // Create a graphics context for advanced drawing
     auto gc = std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create(dc));
@@ -155,8 +169,14 @@ void GameView::OnPaint(wxPaintEvent& event)
     // Get the dimensions of the current view
     wxRect rect = GetRect();
 
-    // Instruct the game to draw its elements
-    mGame.OnDraw(gc, rect.GetWidth(), rect.GetHeight());
+    // Instruct the game to draw its elements, only those in the damaged area
+    mGame.OnDraw(gc, rect.GetWidth(), rect.GetHeight(), GetUpdateRegion().GetBox());
+
+    // the notices are in the middle of the window and may return early, so the overlay goes first
+    if (profiler.IsEnabled())
+    {
+        DrawProfiler(gc.get());
+    }
 
     // Display level message if needed
     if (mDisplayLevelMessage && mGame.GetState() == Game::GameState::Beginning)
@@ -171,16 +191,13 @@ void GameView::OnPaint(wxPaintEvent& event)
             return;
         }
         wxString noticeText = wxString::Format("Level %d Begin", mCurrentLevel);
-        wxFont font(NoticeSize, wxFONTFAMILY_SWISS, wxFONTSTYLE_NORMAL, wxFONTWEIGHT_BOLD);
-        gc->SetFont(font, LevelNoticeColor);
-
-        double textWidth, textHeight;
-        gc->GetTextExtent(noticeText, &textWidth, &textHeight, nullptr, nullptr);
+        auto& text = TextCache::Get();
+        const auto& layout = text.GetLayout(gc.get(), NoticeStyle, noticeText);
 
-        double xPos = (mGame.GetWidth() - textWidth) / 2;
-        double yPos = (mGame.GetHeight() - textHeight) / 2;
+        double xPos = (mGame.GetWidth() - layout.mWidth) / 2;
+        double yPos = (mGame.GetHeight() - layout.mHeight) / 2;
 
-        gc->DrawText(noticeText, xPos, yPos);
+        text.Draw(gc.get(), NoticeStyle, noticeText, xPos, yPos);
     }
     if (mGame.GetState() == Game::GameState::Ending)
     {
@@ -191,16 +208,13 @@ void GameView::OnPaint(wxPaintEvent& event)
         if (mStopWatch.Time() - mEndingMessageTime <= 2000)
         {
             wxString noticeText = wxString::Format("Level %d Complete", mCurrentLevel);
-            wxFont font(NoticeSize, wxFONTFAMILY_SWISS, wxFONTSTYLE_NORMAL, wxFONTWEIGHT_BOLD);
-            gc->SetFont(font, LevelNoticeColor);
+            auto& text = TextCache::Get();
+            const auto& layout = text.GetLayout(gc.get(), NoticeStyle, noticeText);
 
-            double textWidth, textHeight;
-            gc->GetTextExtent(noticeText, &textWidth, &textHeight, nullptr, nullptr);
+            double xPos = (mGame.GetWidth() - layout.mWidth) / 2;
+            double yPos = (mGame.GetHeight() - layout.mHeight) / 2;
 
-            double xPos = (mGame.GetWidth() - textWidth) / 2;
-            double yPos = (mGame.GetHeight() - textHeight) / 2;
-
-            gc->DrawText(noticeText, xPos, yPos);
+            text.Draw(gc.get(), NoticeStyle, noticeText, xPos, yPos);
 
         }
         else if (mStopWatch.Time() - mEndingMessageTime > 2000) // After displaying the ending message
@@ -222,6 +236,84 @@ void GameView::ToggleControlPoints()
     Refresh();
 }
 
+/**
+ * Show or hide the frame profiler overlay and the frame rate in the
+ * status bar
+ */
+void GameView::ToggleProfiler()
+{
+    auto& profiler = FrameProfiler::Get();
+    profiler.SetEnabled(!profiler.IsEnabled());
+    if (profiler.IsEnabled())
+    {
+        UpdateProfilerReadout();
+    }
+    else
+    {
+        mMainFrame->SetStatusText(L"");
+    }
+
+    // the overlay's size is only known once it has been drawn
+    Refresh();
+}
+
+/**
+ * Take the phase percentiles and frame rate from the profiler for the
+ * overlay and the status bar
+ */
+void GameView::UpdateProfilerReadout()
+{
+    auto& profiler = FrameProfiler::Get();
+    typedef FrameProfiler::Phase Phase;
+
+    mProfilerLines.clear();
+    mProfilerLines.push_back(wxString::Format(L"%-12s %8s %8s", L"phase", L"p50 ms", L"p99 ms"));
+    for (size_t i = 0; i < FrameProfiler::PhaseCount; i++)
+    {
+        auto phase = Phase(i);
+        mProfilerLines.push_back(wxString::Format(L"%-12s %8.2f %8.2f", FrameProfiler::GetName(phase),
+                                                  profiler.GetPercentile(phase, 50) * 1000,
+                                                  profiler.GetPercentile(phase, 99) * 1000));
+    }
+
+    double interval = profiler.GetMean(Phase::Interval);
+    double frame = profiler.GetMean(Phase::Timer) + profiler.GetMean(Phase::Paint);
+    mMainFrame->SetStatusText(wxString::Format(L"%.1f fps, frame %.2f ms", interval > 0 ? 1 / interval : 0.0,
+                                               frame * 1000));
+}
+
+/**
+ * Draw the profiler overlay in the top left corner of the window
+ *
+ * The lines are drawn with one font from the text cache rather than
+ * laid out by it, since they change with every readout.
+ *
+ * @param graphics the graphics context, in device pixels
+ */
+void GameView::DrawProfiler(wxGraphicsContext* graphics)
+{
+    // the font is fixed width, so every line is as wide as the header
+    auto& text = TextCache::Get();
+    const auto& header = text.GetLayout(graphics, ProfilerStyle, mProfilerLines.front());
+    double lineHeight = header.mHeight;
+
+    mProfilerRect = wxRect(ProfilerPadding, ProfilerPadding, int(std::ceil(header.mWidth)) + 2 * ProfilerPadding,
+                           int(std::ceil(lineHeight * mProfilerLines.size())) + 2 * ProfilerPadding);
+
+    graphics->SetPen(*wxTRANSPARENT_PEN);
+    graphics->SetBrush(wxBrush(ProfilerBackground));
+    graphics->DrawRectangle(mProfilerRect.GetX(), mProfilerRect.GetY(), mProfilerRect.GetWidth(),
+                            mProfilerRect.GetHeight());
+
+    graphics->SetFont(text.GetFont(graphics, ProfilerStyle));
+    double y = mProfilerRect.GetY() + ProfilerPadding;
+    for (const auto& line : mProfilerLines)
+    {
+        graphics->DrawText(line, mProfilerRect.GetX() + ProfilerPadding, y);
+        y += lineHeight;
+    }
+}
+
 /**
  * Handles the left mouse button down event.
  * Used to detect and manipulate game objects with the mouse.
@@ -240,33 +332,25 @@ void GameView::OnLeftDown(wxMouseEvent& event)
     double gameX = (mouseX - xOffset) / scale;
     double gameY = (mouseY - yOffset) / scale;
 
-    ConveyorVisitor conveyorVisitor;
-    for (const auto& item : game->GetItems())
+    for (auto conveyor : game->GetRegistry().GetConveyors())
     {
-        item->Accept(&conveyorVisitor);
-        if (conveyorVisitor.IsConveyor())
+        if (conveyor->CheckStartButtonClick(gameX, gameY))
+        {
+            conveyor->Start();
+            Refresh();
+            return;
+        }
+        if (conveyor->CheckStopButtonClick(gameX, gameY))
         {
-            Conveyor* conveyor = conveyorVisitor.GetConveyor();
-            if (conveyor->CheckStartButtonClick(gameX, gameY))
-            {
-                conveyor->Start();
-                Refresh();
-                return;
-            }
-            if (conveyor->CheckStopButtonClick(gameX, gameY))
-            {
-                conveyor->Stop();
-                Refresh();
-                return;
-            }
+            conveyor->Stop();
+            Refresh();
+            return;
         }
     }
 
 
-    mSelectedOutputPin = nullptr;
-    GateOutputPinHitTestVisitor outputPinVisitor(gameX, gameY);
-    game->Accept(&outputPinVisitor);
-    mSelectedOutputPin = outputPinVisitor.GetSelectedOutputPin();
+    auto outputPin = game->HitTestOutputPin(gameX, gameY);
+    mSelectedOutputPin = outputPin != nullptr ? game->GetPins().GetHandle(outputPin) : OutputPinHandle();
 
 
     GateGrabVisitor grabVisitor(gameX, gameY);
@@ -298,18 +382,18 @@ void GameView::OnLeftUp(wxMouseEvent& event)
     double gameX = (mouseX - xOffset) / scale;
     double gameY = (mouseY - yOffset) / scale;
 
-    if (mSelectedOutputPin != nullptr)
+    // the pin may have been removed, or moved in the pool, since the drag began
+    auto outputPin = game->GetPins().Get(mSelectedOutputPin);
+    if (outputPin != nullptr)
     {
-        GateInputPinHitTestVisitor inputPinVisitor(gameX, gameY);
-        game->Accept(&inputPinVisitor);
-        PinInput* inputPin = inputPinVisitor.GetInputPin();
+        PinInput* inputPin = game->HitTestInputPin(gameX, gameY);
         if (inputPin != nullptr)
         {
-            mGame.AddWire(mSelectedOutputPin, inputPin);
+            mGame.AddWire(outputPin, inputPin);
         }
     }
 
-    mSelectedOutputPin = nullptr;
+    mSelectedOutputPin = OutputPinHandle();
     mDraggingWire = nullptr;
     mGrabbedGate = nullptr;
     Refresh();
@@ -338,7 +422,7 @@ void GameView::OnMouseMove(wxMouseEvent& event)
     if (mGrabbedGate != nullptr && event.Dragging() && event.LeftIsDown())
     {
         mGrabbedGate->SetPosition(gameX, gameY);
-        Refresh();
+        RefreshDamage(mGame.CollectDamage());
     }
 }
 
@@ -424,13 +508,60 @@ void GameView::DisplayLevelMessage(int level)
 
 /**
  * Creates a timer for animation
+ *
+ * The wall clock time only feeds the game's accumulator; the game
+ * itself always advances in fixed ticks.
  */
 void GameView::OnTimer(wxTimerEvent&)
 {
-    auto newTime = mStopWatch.Time();
-    auto elapsed = (double)(newTime - mTime) * 0.001;
-    mTime = newTime;
+    // a frame is the timer event and the paint it asks for
+    auto& profiler = FrameProfiler::Get();
+    profiler.EndFrame();
 
-    mGame.Update(elapsed);
-    Refresh();
+    {
+        ScopedTimer timer(profiler, FrameProfiler::Phase::Timer);
+
+        auto newTime = mStopWatch.Time();
+        auto elapsed = (double)(newTime - mTime) * 0.001;
+        mTime = newTime;
+
+        mGame.Advance(elapsed);
+        RefreshDamage(mGame.CollectDamage());
+    }
+
+    if (profiler.IsEnabled() && ++mProfilerFrames >= ProfilerReadoutFrames)
+    {
+        mProfilerFrames = 0;
+        UpdateProfilerReadout();
+        RefreshRect(mProfilerRect, false);
+    }
+}
+
+/**
+ * Repaint the areas of the game that changed
+ *
+ * While a level message is showing, or before the game has been drawn
+ * and its scale is known, the whole window is repainted instead.
+ *
+ * @param damage the changed areas, in virtual pixels
+ */
+void GameView::RefreshDamage(const DamageRegion& damage)
+{
+    double scale = mGame.GetScale();
+    if (damage.IsAll() || scale == 0 || mDisplayLevelMessage || mGame.GetState() != Game::GameState::Playing)
+    {
+        Refresh();
+        return;
+    }
+
+    for (const auto& rect : damage.GetRects())
+    {
+        int left = int(std::floor(rect.mLeft * scale + mGame.GetXOffset()));
+        int top = int(std::floor(rect.mTop * scale + mGame.GetYOffset()));
+        int right = int(std::ceil(rect.mRight * scale + mGame.GetXOffset()));
+        int bottom = int(std::ceil(rect.mBottom * scale + mGame.GetYOffset()));
+
+        // a pixel or two more for antialiased edges
+        RefreshRect(wxRect(left, top, right - left, bottom - top).Inflate(DamageMargin), false);
+    }
 }
@@ -27,7 +27,8 @@ private:
     /// current item we are dragging
     std::shared_ptr<Item> mGrabbedItem;
     std::shared_ptr<Gate> mGrabbedGate = nullptr;
-    PinOutput* mSelectedOutputPin = nullptr;
+    /// output pin a wire is being dragged from, resolved on each use since pins move in the pool
+    OutputPinHandle mSelectedOutputPin;
     std::shared_ptr<Wire> mDraggingWire;
     PinInput* mSelectedInputPin = nullptr;
     bool mDisplayLevelMessage = false;
@@ -41,6 +42,21 @@ private:
     /// The current time
     long mTime = 0;
 
+    /// The frame whose status bar shows the frame rate
+    wxFrame* mMainFrame = nullptr;
+
+    /// Lines of the profiler overlay, from the last readout
+    std::vector<wxString> mProfilerLines;
+
+    /// Where the profiler overlay is drawn, in device pixels
+    wxRect mProfilerRect;
+
+    /// Frames since the profiler readout was last updated
+    int mProfilerFrames = 0;
+
+    void UpdateProfilerReadout();
+    void DrawProfiler(wxGraphicsContext* graphics);
+
 public:
     GameView();
     void OnTimer(wxTimerEvent& event);
@@ -61,7 +77,9 @@ public:
     auto OnAddDFLipFlopGate(wxCommandEvent& event) -> void;
     void AddGate(std::shared_ptr<Gate> gate);
     void ToggleControlPoints();
+    void ToggleProfiler();
     void DisplayLevelMessage(int level);
+    void RefreshDamage(const DamageRegion& damage);
     /**
      * Getter for Game
      * @return The Game
@@ -12,8 +12,19 @@
 #include <wx/event.h>
 
 #include "PinInput.h"
+#include "GateLogic.h"
+#include "Game.h"
+#include "TextCache.h"
+#include <cassert>
 
 // Define constant sizes for gates (kept in Gate.h)
+
+/// Reach of the pins and pin lines beyond a gate's body
+const double GateBoundsMargin = 20;
+
+/// Style of the pin labels of the flip flops
+const TextCache::Style LabelStyle = {10, false, wxFONTFAMILY_DEFAULT, L"", false, wxColour(0, 0, 0)};
+
 /**
  * Tests if a point is within the gate's bounding box.
  *
@@ -37,6 +48,17 @@ void Gate::SetPosition(double x, double y) {
     mY = y;
     UpdatePinPositions();
 }
+/**
+ * The area the gate draws in, its body, pin lines and pins.
+ *
+ * @return the bounds in virtual pixels
+ */
+DamageRegion::Rect Gate::GetBounds() const
+{
+    double halfWidth = GetWidth() / 2 + GateBoundsMargin;
+    double halfHeight = GetHeight() / 2 + GateBoundsMargin;
+    return {GetX() - halfWidth, GetY() - halfHeight, GetX() + halfWidth, GetY() + halfHeight};
+}
 /**
  * Handles mouse click events by determining if a gate is clicked.
  *
@@ -62,21 +84,120 @@ void Gate::UpdatePinPositions() {
     // Position input pins
     for (size_t i = 0; i < mInputPins.size(); ++i) {
         double yOffset = h * (i + 1) / (mInputPins.size() + 1) - h / 2;
-        mInputPins[i].SetPosition(x - w / 2, y + yOffset);
+        InputPin(i).SetPosition(x - w / 2, y + yOffset);
     }
 
     // Position output pins
     for (size_t i = 0; i < mOutputPins.size(); ++i) {
         double yOffset = h * (i + 1) / (mOutputPins.size() + 1) - h / 2;
-        mOutputPins[i].SetPosition(x + w / 2, y + yOffset);
+        OutputPin(i).SetPosition(x + w / 2, y + yOffset);
     }
 }
+/**
+ * Destructor, returns the gate's pins to the game.
+ */
+Gate::~Gate()
+{
+    auto& pins = GetGame()->GetPins();
+    for (auto handle : mInputPins)
+    {
+        pins.Remove(handle);
+    }
+    for (auto handle : mOutputPins)
+    {
+        pins.Remove(handle);
+    }
+}
+
+/**
+ * Add an input pin to the gate, after any it already has.
+ */
+void Gate::AddInputPin()
+{
+    mInputPins.push_back(GetGame()->GetPins().AddInput());
+}
+
+/**
+ * Add an output pin to the gate, after any it already has.
+ */
+void Gate::AddOutputPin()
+{
+    mOutputPins.push_back(GetGame()->GetPins().AddOutput());
+}
+
+/**
+ * Get one of the gate's input pins.
+ *
+ * The reference is only good until pins are next added or removed.
+ * The gate's pins live as long as the gate, so the handle is never
+ * stale.
+ *
+ * @param index index of the pin, in the order they were added
+ * @return the pin
+ */
+PinInput& Gate::InputPin(size_t index)
+{
+    auto pin = GetGame()->GetPins().Get(mInputPins[index]);
+    assert(pin != nullptr && "gate input pin removed before its gate");
+    return *pin;
+}
+
+/**
+ * Get one of the gate's output pins.
+ *
+ * The reference is only good until pins are next added or removed.
+ *
+ * @param index index of the pin, in the order they were added
+ * @return the pin
+ */
+PinOutput& Gate::OutputPin(size_t index)
+{
+    auto pin = GetGame()->GetPins().Get(mOutputPins[index]);
+    assert(pin != nullptr && "gate output pin removed before its gate");
+    return *pin;
+}
+
 /**
  * Initializes the positions of pins on the gate.
  */
 void Gate::InitializePins() {
     UpdatePinPositions();
 }
+
+/**
+ * Draws the gate and its pins.
+ *
+ * The outline is built once around (0, 0) and only translated to the
+ * gate. The label font comes from the TextCache.
+ *
+ * @param graphics the graphics context to draw on
+ */
+void Gate::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+{
+    auto renderer = graphics->GetRenderer();
+    if (renderer != mShapeRenderer)
+    {
+        mPath = graphics->CreatePath();
+        AddShape(mPath);
+        mShapeRenderer = renderer;
+    }
+
+    graphics->PushState();
+    graphics->Translate(GetX(), GetY());
+    graphics->SetPen(*wxBLACK_PEN);
+    graphics->SetBrush(*wxWHITE_BRUSH);
+    graphics->DrawPath(mPath);
+    graphics->SetFont(TextCache::Get().GetFont(graphics.get(), LabelStyle));
+    DrawLabels(graphics.get());
+    graphics->PopState();
+
+    for (size_t i = 0; i < mInputPins.size(); ++i) {
+        InputPin(i).Draw(graphics);
+    }
+    for (size_t i = 0; i < mOutputPins.size(); ++i) {
+        OutputPin(i).Draw(graphics);
+    }
+}
 /**
  * Constructor for the OR gate.
  *
@@ -84,9 +205,9 @@ void Gate::InitializePins() {
 ORGate::ORGate(Game* game) : Gate(game, L""),
     inputA(States::Unknown), inputB(States::Unknown)
 {
-    mInputPins.emplace_back(PinInput());
-    mInputPins.emplace_back(PinInput());
-    mOutputPins.emplace_back(PinOutput());
+    AddInputPin();
+    AddInputPin();
+    AddOutputPin();
     UpdatePinPositions();
 }
 /**
@@ -115,7 +236,7 @@ void ORGate::SetPosition(double x, double y) {
  */
 PinInput* ORGate::GetInputPin(int index) {
     if (index >= 0 && index < mInputPins.size()) {
-        return &mInputPins[index];
+        return &InputPin(index);
     }
     return nullptr;
 }
@@ -125,44 +246,27 @@ PinInput* ORGate::GetInputPin(int index) {
  */
 PinOutput* ORGate::GetOutputPin() {
     if (!mOutputPins.empty()) {
-        return &mOutputPins[0];
+        return &OutputPin(0);
     }
     return nullptr;
 }
-/**
- * Connects an input pin of this gate to an output pin of another gate.
- */
-void ORGate::ConnectInput(int inputIndex, PinOutput* outputPin) {
-    if (inputIndex >= 0 && inputIndex < mInputPins.size()) {
-        mInputPins[inputIndex].SetConnection(outputPin);
-        outputPin->AddConnection(&mInputPins[inputIndex]);
-    }
-}
 /**
  * Computes the output of the OR gate based on the states of its inputs.
  */
 States ORGate::ComputeOutput() {
-    if (inputA == States::Unknown || inputB == States::Unknown) {
-        return States::Unknown;
-    }
-    return (inputA == States::One || inputB == States::One) ? States::One : States::Zero;
+    return ComputeOr(inputA, inputB);
 }
 /**
- * Draws orgate
+ * Adds the OR gate's curved body and output line, centered on (0, 0)
  */
-void ORGate::Draw(std::shared_ptr<wxGraphicsContext> graphics) {
-    auto path = graphics->CreatePath();
-
-    // The location and size
-    auto x = GetX();
-    auto y = GetY();
+void ORGate::AddShape(wxGraphicsPath& path) const {
     auto w = GetWidth();
     auto h = GetHeight();
 
     // The three corner points of an OR gate
-    wxPoint2DDouble p1(x - w / 2, y + h / 2);   // Bottom left
-    wxPoint2DDouble p2(x + w / 2, y);            // Center right
-    wxPoint2DDouble p3(x - w / 2, y - h / 2);   // Top left
+    wxPoint2DDouble p1(-w / 2, h / 2);   // Bottom left
+    wxPoint2DDouble p2(w / 2, 0);        // Center right
+    wxPoint2DDouble p3(-w / 2, -h / 2);  // Top left
 
     // Control points used to create the Bezier curves
     auto controlPointOffset1 = wxPoint2DDouble(w * 0.5, 0);
@@ -176,22 +280,9 @@ void ORGate::Draw(std::shared_ptr<wxGraphicsContext> graphics) {
     path.AddCurveToPoint(p3 + controlPointOffset3, p1 + controlPointOffset3, p1);
     path.CloseSubpath();
 
-    // Draw the path
-    graphics->SetPen(*wxBLACK_PEN);
-    graphics->SetBrush(*wxWHITE_BRUSH);
-    graphics->DrawPath(path);
-
-    // Draw input and output lines
-    graphics->SetPen(*wxBLACK_PEN);
-    double curveOffset = w * 0.2; // Adjust this value to match the curve of your gate
-    // Draw pins
-    graphics->StrokeLine(x + w/2, y, x + w/2 + 20, y);
-    for (auto& pin : mInputPins) {
-        pin.Draw(graphics);
-    }
-    for (auto& pin : mOutputPins) {
-        pin.Draw(graphics);
-    }
+    // Output line
+    path.MoveToPoint(w/2, 0);
+    path.AddLineToPoint(w/2 + 20, 0);
 }
 /**
  *Upating the ORgate pins position
@@ -205,11 +296,11 @@ void ORGate::UpdatePinPositions()
     double curveOffset = w * 0.2;
 
     // Position input pins so that the lines touch the gate's edge
-    mInputPins[0].SetPosition(x - w/2 + curveOffset - PinInput::DefaultLineLength, y - h/4);
-    mInputPins[1].SetPosition(x - w/2 + curveOffset - PinInput::DefaultLineLength, y + h/4);
+    InputPin(0).SetPosition(x - w/2 + curveOffset - PinInput::DefaultLineLength, y - h/4);
+    InputPin(1).SetPosition(x - w/2 + curveOffset - PinInput::DefaultLineLength, y + h/4);
 
     // Position output pin
-    mOutputPins[0].SetPosition(x + w/2 + 20, y);
+    OutputPin(0).SetPosition(x + w/2 + 20, y);
 }
 /**
  * Constructor for the AND gate.
@@ -217,9 +308,9 @@ void ORGate::UpdatePinPositions()
 ANDGate::ANDGate(Game* game) : Gate(game, L""),
     inputA(States::Unknown), inputB(States::Unknown)
 {
-    mInputPins.emplace_back(PinInput());
-    mInputPins.emplace_back(PinInput());
-    mOutputPins.emplace_back(PinOutput());
+    AddInputPin();
+    AddInputPin();
+    AddOutputPin();
     InitializePins();
 }
 /**
@@ -241,10 +332,7 @@ void ANDGate::SetInputB(States state) {
  * @return States
  */
 States ANDGate::ComputeOutput() {
-    if (inputA == States::Unknown || inputB == States::Unknown) {
-        return States::Unknown;
-    }
-    return (inputA == States::One && inputB == States::One) ? States::One : States::Zero;
+    return ComputeAnd(inputA, inputB);
 }
 /**
  * Set positon of AND gate
@@ -264,57 +352,42 @@ void ANDGate::UpdatePinPositions()
     double h = GetHeight();
 
     // Position input pins at the left end of the input lines
-    mInputPins[0].SetPosition(x - w/2 - 20, y - h/4);
-    mInputPins[1].SetPosition(x - w/2 - 20, y + h/4);
+    InputPin(0).SetPosition(x - w/2 - 20, y - h/4);
+    InputPin(1).SetPosition(x - w/2 - 20, y + h/4);
 
     // Position output pin at the right end of the output line
-    mOutputPins[0].SetPosition(x + w/2 + 20, y);
+    OutputPin(0).SetPosition(x + w/2 + 20, y);
 }
 /**
- * drawing of the AND gate
+ * Adds the AND gate's body and its input and output lines, centered on (0, 0)
  */
-void ANDGate::Draw(std::shared_ptr<wxGraphicsContext> graphics) {
-    auto path = graphics->CreatePath();
-
-    // The location and size
-    auto x = GetX();
-    auto y = GetY();
+void ANDGate::AddShape(wxGraphicsPath& path) const {
     auto w = GetWidth();
     auto h = GetHeight();
 
     // Key points for the rectangle and semicircle
-    wxPoint2DDouble p1(x - w / 2, y + h / 2);   // Bottom left of the rectangle
-    wxPoint2DDouble p2(x + w / 4, y + h / 2);   // Bottom right (before the arc)
-    wxPoint2DDouble p3(x + w / 4, y - h / 2);   // Top right (before the arc)
-    wxPoint2DDouble p4(x - w / 2, y - h / 2);   // Top left of the rectangle
+    wxPoint2DDouble p1(-w / 2, h / 2);   // Bottom left of the rectangle
+    wxPoint2DDouble p2(w / 4, h / 2);    // Bottom right (before the arc)
+    wxPoint2DDouble p3(w / 4, -h / 2);   // Top right (before the arc)
+    wxPoint2DDouble p4(-w / 2, -h / 2);  // Top left of the rectangle
 
     // Create the path for the AND gate (rectangle + arc for the right side)
     path.MoveToPoint(p1);
     path.AddLineToPoint(p2);
-    path.AddArc(x + w / 4, y, h / 2, M_PI / 2, -M_PI / 2, false);
+    path.AddArc(w / 4, 0, h / 2, M_PI / 2, -M_PI / 2, false);
     path.AddLineToPoint(p3);
     path.AddLineToPoint(p4);
     path.CloseSubpath();
 
-    // Draw the path
-    graphics->SetPen(*wxBLACK_PEN);
-    graphics->SetBrush(*wxWHITE_BRUSH);
-    graphics->DrawPath(path);
-
-    // Draw input lines
-    graphics->StrokeLine(x - w/2, y - h/4, x - w/2 - 20, y - h/4);
-    graphics->StrokeLine(x - w/2, y + h/4, x - w/2 - 20, y + h/4);
-
-    // Draw output line
-    graphics->StrokeLine(x + w/2, y, x + w/2 + 20, y);
+    // Input lines
+    path.MoveToPoint(-w/2, -h/4);
+    path.AddLineToPoint(-w/2 - 20, -h/4);
+    path.MoveToPoint(-w/2, h/4);
+    path.AddLineToPoint(-w/2 - 20, h/4);
 
-    // Draw the pins
-    for (auto& pin : mInputPins) {
-        pin.Draw(graphics);
-    }
-    for (auto& pin : mOutputPins) {
-        pin.Draw(graphics);
-    }
+    // Output line
+    path.MoveToPoint(w/2, 0);
+    path.AddLineToPoint(w/2 + 20, 0);
 }
 
 /**
@@ -323,8 +396,8 @@ void ANDGate::Draw(std::shared_ptr<wxGraphicsContext> graphics) {
 NOTGate::NOTGate(Game* game) : Gate(game, L""),
     inputA(States::Unknown)
 {
-    mInputPins.emplace_back(PinInput());
-    mOutputPins.emplace_back(PinOutput());
+    AddInputPin();
+    AddOutputPin();
     InitializePins();
     UpdatePinPositions();
 }
@@ -339,10 +412,7 @@ void NOTGate::SetInputA(States state) {
  * Compute output for NOT gate
  */
 States NOTGate::ComputeOutput() {
-    if (inputA == States::Unknown) {
-        return States::Unknown;
-    }
-    return (inputA == States::One) ? States::Zero : States::One;
+    return ComputeNot(inputA);
 }
 /**
  * Set positon of NOT gate
@@ -360,25 +430,20 @@ void NOTGate::UpdatePinPositions()
     double y = GetY();
     double w = GetWidth();
     double h = GetHeight();
-    mInputPins[0].SetPosition(x - w/2 - 20, y);  // Input pin
-    mOutputPins[0].SetPosition(x + w/2 + h/4 + 20, y);  // Output pin after
+    InputPin(0).SetPosition(x - w/2 - 20, y);  // Input pin
+    OutputPin(0).SetPosition(x + w/2 + h/4 + 20, y);  // Output pin after
 }
 /**
- * Drawing NOT gate
+ * Adds the NOT gate's triangle, inversion circle and lines, centered on (0, 0)
  */
-void NOTGate::Draw(std::shared_ptr<wxGraphicsContext> graphics) {
-    auto path = graphics->CreatePath();
-
-    // The location and size
-    auto x = GetX();
-    auto y = GetY();
+void NOTGate::AddShape(wxGraphicsPath& path) const {
     auto w = GetWidth();  // Width of the NOT gate
     auto h = GetHeight(); // Height of the NOT gate
 
     // Key points for the triangle and circle
-    wxPoint2DDouble p1(x - w / 2, y + h / 2);   // Bottom left of the triangle
-    wxPoint2DDouble p2(x - w / 2, y - h / 2);   // Top left of the triangle
-    wxPoint2DDouble p3(x + w / 2, y);            // Point of the triangle (right)
+    wxPoint2DDouble p1(-w / 2, h / 2);   // Bottom left of the triangle
+    wxPoint2DDouble p2(-w / 2, -h / 2);  // Top left of the triangle
+    wxPoint2DDouble p3(w / 2, 0);        // Point of the triangle (right)
 
     // Create the path for the NOT gate (triangle)
     path.MoveToPoint(p1);                          // Move to bottom left of triangle
@@ -386,26 +451,16 @@ void NOTGate::Draw(std::shared_ptr<wxGraphicsContext> graphics) {
     path.AddLineToPoint(p3);                       // Draw line to the point of the triangle
     path.CloseSubpath();                           // Close the triangle
 
-    // Draw the triangle part of the NOT gate
-    graphics->SetPen(*wxBLACK_PEN);
-    graphics->SetBrush(*wxWHITE_BRUSH);
-    graphics->DrawPath(path);
-
-    // Draw the inversion circle at the point of the triangle
-    graphics->DrawEllipse(x + w / 2 - h / 4, y - h / 4, h / 2, h / 2);
-
-    graphics->StrokeLine(x - w/2, y, x - w/2 - 20, y);
+    // The inversion circle at the point of the triangle
+    path.AddEllipse(w / 2 - h / 4, -h / 4, h / 2, h / 2);
 
-    // Draw output line (after the inversion circle)
-    graphics->StrokeLine(x + w/2 + h/4, y, x + w/2 + h/4 + 20, y);
+    // Input line
+    path.MoveToPoint(-w/2, 0);
+    path.AddLineToPoint(-w/2 - 20, 0);
 
-    // Draw the pins
-    for (auto& pin : mInputPins) {
-        pin.Draw(graphics);
-    }
-    for (auto& pin : mOutputPins) {
-        pin.Draw(graphics);
-    }
+    // Output line (after the inversion circle)
+    path.MoveToPoint(w/2 + h/4, 0);
+    path.AddLineToPoint(w/2 + h/4 + 20, 0);
 }
 
 
@@ -415,10 +470,10 @@ void NOTGate::Draw(std::shared_ptr<wxGraphicsContext> graphics) {
 SRFlipFlopGate::SRFlipFlopGate(Game* game) : Gate(game, L""),
     inputS(States::Unknown), inputR(States::Unknown)
 {
-    mInputPins.emplace_back(PinInput());  // S input
-    mInputPins.emplace_back(PinInput());  // R input
-    mOutputPins.emplace_back(PinOutput());  // Q output
-    mOutputPins.emplace_back(PinOutput());  // Q' output
+    AddInputPin();  // S input
+    AddInputPin();  // R input
+    AddOutputPin();  // Q output
+    AddOutputPin();  // Q' output
     InitializePins();
     UpdatePinPositions();
 }
@@ -469,37 +524,31 @@ void SRFlipFlopGate::UpdatePinPositions()
     double w = GetWidth();
     double h = GetHeight();
 
-    mInputPins[0].SetPosition(x - w/2 - 20, y - h/4);  // S input
-    mInputPins[1].SetPosition(x - w/2 - 20, y + h/4);  // R input
-    mOutputPins[0].SetPosition(x + w/2 + 20, y - h/4);  // Q output
-    mOutputPins[1].SetPosition(x + w/2 + 20, y + h/4);  // Q' output
+    InputPin(0).SetPosition(x - w/2 - 20, y - h/4);  // S input
+    InputPin(1).SetPosition(x - w/2 - 20, y + h/4);  // R input
+    OutputPin(0).SetPosition(x + w/2 + 20, y - h/4);  // Q output
+    OutputPin(1).SetPosition(x + w/2 + 20, y + h/4);  // Q' output
 }
 /**
- * Draw SR gate
+ * Adds the SR flip-flop's body and its input and output lines, centered on (0, 0)
  */
-void SRFlipFlopGate::Draw(std::shared_ptr<wxGraphicsContext> graphics) {
-    auto path = graphics->CreatePath();
-
-    // The location and size
-    auto x = GetX();
-    auto y = GetY();
+void SRFlipFlopGate::AddShape(wxGraphicsPath& path) const {
     auto w = GetWidth();
     auto h = GetHeight();
 
-    // Draw the body of the SR flip-flop (rectangle with rounded corners)
-    path.AddRoundedRectangle(x - w / 2, y - h / 2, w, h, 10);
+    // The body of the SR flip-flop (rectangle with rounded corners)
+    path.AddRoundedRectangle(-w / 2, -h / 2, w, h, 10);
 
-    // Draw the input and output connections
-    wxPoint2DDouble p1(x - w / 2, y - h / 4);   // Input S
-    wxPoint2DDouble p2(x - w / 2 - 20, y - h / 4); // Input S connection point
-    wxPoint2DDouble p3(x - w / 2, y + h / 4);   // Input R
-    wxPoint2DDouble p4(x - w / 2 - 20, y + h / 4); // Input R connection point
-    wxPoint2DDouble p5(x + w / 2, y - h / 4);   // Output Q
-    wxPoint2DDouble p6(x + w / 2 + 20, y - h / 4); // Output Q connection point
-    wxPoint2DDouble p7(x + w / 2, y + h / 4);   // Output Q'
-    wxPoint2DDouble p8(x + w / 2 + 20, y + h / 4); // Output Q' connection point
+    // The input and output connections
+    wxPoint2DDouble p1(-w / 2, -h / 4);      // Input S
+    wxPoint2DDouble p2(-w / 2 - 20, -h / 4); // Input S connection point
+    wxPoint2DDouble p3(-w / 2, h / 4);       // Input R
+    wxPoint2DDouble p4(-w / 2 - 20, h / 4);  // Input R connection point
+    wxPoint2DDouble p5(w / 2, -h / 4);       // Output Q
+    wxPoint2DDouble p6(w / 2 + 20, -h / 4);  // Output Q connection point
+    wxPoint2DDouble p7(w / 2, h / 4);        // Output Q'
+    wxPoint2DDouble p8(w / 2 + 20, h / 4);   // Output Q' connection point
 
-    // Create path for the input and output lines
     path.MoveToPoint(p1);
     path.AddLineToPoint(p2);
     path.MoveToPoint(p3);
@@ -508,35 +557,19 @@ void SRFlipFlopGate::Draw(std::shared_ptr<wxGraphicsContext> graphics) {
     path.AddLineToPoint(p6);
     path.MoveToPoint(p7);
     path.AddLineToPoint(p8);
+}
 
-    // Draw the SR flip-flop gate
-    graphics->SetPen(*wxBLACK_PEN);
-    graphics->SetBrush(*wxWHITE_BRUSH);
-    graphics->DrawPath(path);
-
-    // Set font for labels
-    wxFont font(10, wxFONTFAMILY_DEFAULT, wxFONTSTYLE_NORMAL, wxFONTWEIGHT_NORMAL);
-    graphics->SetFont(font, *wxBLACK);
-
-    // Draw labels
-    graphics->DrawText("S", x - w / 2 + 5, y - h / 4 - 10);
-    graphics->DrawText("R", x - w / 2 + 5, y + h / 4 - 10);
-    graphics->DrawText("Q", x + w / 2 - 15, y - h / 4 - 10);
-    graphics->DrawText("Q'", x + w / 2 - 15, y + h / 4 - 10);
-
-    graphics->StrokeLine(x - w/2, y - h/4, x - w/2 - 20, y - h/4);  // S input
-    graphics->StrokeLine(x - w/2, y + h/4, x - w/2 - 20, y + h/4);  // R input
-    graphics->StrokeLine(x + w/2, y - h/4, x + w/2 + 20, y - h/4);  // Q output
-    graphics->StrokeLine(x + w/2, y + h/4, x + w/2 + 20, y + h/4);  // Q' output
-
-    // Draw the pins
-    for (auto& pin : mInputPins) {
-        pin.Draw(graphics);
-    }
-    for (auto& pin : mOutputPins) {
-        pin.Draw(graphics);
-    }
+/**
+ * Draws the S, R, Q and Q' labels, centered on (0, 0)
+ */
+void SRFlipFlopGate::DrawLabels(wxGraphicsContext* graphics) const {
+    auto w = GetWidth();
+    auto h = GetHeight();
 
+    graphics->DrawText("S", -w / 2 + 5, -h / 4 - 10);
+    graphics->DrawText("R", -w / 2 + 5, h / 4 - 10);
+    graphics->DrawText("Q", w / 2 - 15, -h / 4 - 10);
+    graphics->DrawText("Q'", w / 2 - 15, h / 4 - 10);
 }
 
 /**
@@ -545,10 +578,10 @@ void SRFlipFlopGate::Draw(std::shared_ptr<wxGraphicsContext> graphics) {
 DFlipFlopGate::DFlipFlopGate(Game* game) : Gate(game, L""),
     inputD(States::Unknown), clock(States::Unknown)
 {
-    mInputPins.emplace_back(PinInput());  // D input
-    mInputPins.emplace_back(PinInput());  // Clock input
-    mOutputPins.emplace_back(PinOutput());  // Q output
-    mOutputPins.emplace_back(PinOutput());  // Q' output
+    AddInputPin();  // D input
+    AddInputPin();  // Clock input
+    AddOutputPin();  // Q output
+    AddOutputPin();  // Q' output
     InitializePins();
     UpdatePinPositions();
 }
@@ -583,31 +616,25 @@ void DFlipFlopGate::SetPosition(double x, double y) {
     UpdatePinPositions();
 }
 /**
- * draw D flip flop gate
+ * Adds the D flip-flop's body, clock triangle and lines, centered on (0, 0)
  */
-void DFlipFlopGate::Draw(std::shared_ptr<wxGraphicsContext> graphics) {
-    auto path = graphics->CreatePath();
-
-    // The location and size
-    auto x = GetX();
-    auto y = GetY();
+void DFlipFlopGate::AddShape(wxGraphicsPath& path) const {
     auto w = GetWidth();
     auto h = GetHeight();
 
-    // Draw the body of the D flip-flop (rectangle with rounded corners)
-    path.AddRoundedRectangle(x - w / 2, y - h / 2, w, h, 10);
+    // The body of the D flip-flop (rectangle with rounded corners)
+    path.AddRoundedRectangle(-w / 2, -h / 2, w, h, 10);
 
-    // Draw the input and output connections
-    wxPoint2DDouble p1(x - w / 2, y - h / 4);   // Input D
-    wxPoint2DDouble p2(x - w / 2 - 20, y - h / 4); // Input D connection point
-    wxPoint2DDouble p3(x - w / 2, y + h / 4);   // Clock input
-    wxPoint2DDouble p4(x - w / 2 - 20, y + h / 4); // Clock input connection point
-    wxPoint2DDouble p5(x + w / 2, y - h / 4);   // Output Q
-    wxPoint2DDouble p6(x + w / 2 + 20, y - h / 4); // Output Q connection point
-    wxPoint2DDouble p7(x + w / 2, y + h / 4);   // Output Q'
-    wxPoint2DDouble p8(x + w / 2 + 20, y + h / 4); // Output Q' connection point
+    // The input and output connections
+    wxPoint2DDouble p1(-w / 2, -h / 4);      // Input D
+    wxPoint2DDouble p2(-w / 2 - 20, -h / 4); // Input D connection point
+    wxPoint2DDouble p3(-w / 2, h / 4);       // Clock input
+    wxPoint2DDouble p4(-w / 2 - 20, h / 4);  // Clock input connection point
+    wxPoint2DDouble p5(w / 2, -h / 4);       // Output Q
+    wxPoint2DDouble p6(w / 2 + 20, -h / 4);  // Output Q connection point
+    wxPoint2DDouble p7(w / 2, h / 4);        // Output Q'
+    wxPoint2DDouble p8(w / 2 + 20, h / 4);   // Output Q' connection point
 
-    // Create path for the input and output lines
     path.MoveToPoint(p1);
     path.AddLineToPoint(p2);
     path.MoveToPoint(p3);
@@ -617,40 +644,22 @@ void DFlipFlopGate::Draw(std::shared_ptr<wxGraphicsContext> graphics) {
     path.MoveToPoint(p7);
     path.AddLineToPoint(p8);
 
-    // Draw the D flip-flop gate
-    graphics->SetPen(*wxBLACK_PEN);
-    graphics->SetBrush(*wxWHITE_BRUSH);
-    graphics->DrawPath(path);
-
-    // Draw the clock input triangle
-    wxPoint2DDouble trianglePoints[3] = {
-        wxPoint2DDouble(x - w / 2, y + h / 4 - 10),
-        wxPoint2DDouble(x - w / 2 + 15, y + h / 4),
-        wxPoint2DDouble(x - w / 2, y + h / 4 + 10)
-    };
-    graphics->DrawLines(3, trianglePoints);
-
-    // Set font for labels
-    wxFont font(10, wxFONTFAMILY_DEFAULT, wxFONTSTYLE_NORMAL, wxFONTWEIGHT_NORMAL);
-    graphics->SetFont(font, *wxBLACK);
-
-    // Draw labels
-    graphics->DrawText("D", x - w / 2 + 5, y - h / 4 - 10);
-    graphics->DrawText("Q", x + w / 2 - 15, y - h / 4 - 10);
-    graphics->DrawText("Q'", x + w / 2 - 15, y + h / 4 - 10);
-
-    graphics->StrokeLine(x - w/2, y - h/4, x - w/2 - 20, y - h/4);  // D input
-    graphics->StrokeLine(x - w/2, y + h/4, x - w/2 - 20, y + h/4);  // Clock input
-    graphics->StrokeLine(x + w/2, y - h/4, x + w/2 + 20, y - h/4);  // Q output
-    graphics->StrokeLine(x + w/2, y + h/4, x + w/2 + 20, y + h/4);  // Q' output
-
-    // Draw the pins
-    for (auto& pin : mInputPins) {
-        pin.Draw(graphics);
-    }
-    for (auto& pin : mOutputPins) {
-        pin.Draw(graphics);
-    }
+    // The clock input triangle
+    path.MoveToPoint(-w / 2, h / 4 - 10);
+    path.AddLineToPoint(-w / 2 + 15, h / 4);
+    path.AddLineToPoint(-w / 2, h / 4 + 10);
+}
+
+/**
+ * Draws the D, Q and Q' labels, centered on (0, 0)
+ */
+void DFlipFlopGate::DrawLabels(wxGraphicsContext* graphics) const {
+    auto w = GetWidth();
+    auto h = GetHeight();
+
+    graphics->DrawText("D", -w / 2 + 5, -h / 4 - 10);
+    graphics->DrawText("Q", w / 2 - 15, -h / 4 - 10);
+    graphics->DrawText("Q'", w / 2 - 15, h / 4 - 10);
 }
 /**
  * Updating pin positions
@@ -662,10 +671,10 @@ void DFlipFlopGate::UpdatePinPositions()
     double w = GetWidth();
     double h = GetHeight();
 
-    mInputPins[0].SetPosition(x - w/2 - 20, y - h/4);  // D input
-    mInputPins[1].SetPosition(x - w/2 - 20, y + h/4);  // Clock input
-    mOutputPins[0].SetPosition(x + w/2 + 20, y - h/4);  // Q output
-    mOutputPins[1].SetPosition(x + w/2 + 20, y + h/4);  // Q' output
+    InputPin(0).SetPosition(x - w/2 - 20, y - h/4);  // D input
+    InputPin(1).SetPosition(x - w/2 - 20, y + h/4);  // Clock input
+    OutputPin(0).SetPosition(x + w/2 + 20, y - h/4);  // Q output
+    OutputPin(1).SetPosition(x + w/2 + 20, y + h/4);  // Q' output
 }
 /**
  * Accepting the visitor from Item
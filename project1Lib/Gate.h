@@ -59,18 +59,37 @@ private:
     double mX = 0;
     ///< Y position of the gate
     double mY = 0;
-    ///path member variable
+    /// outline and lines of the gate, centered on (0, 0)
     wxGraphicsPath mPath;
+    /// renderer mPath was made by, nullptr until the first draw
+    wxGraphicsRenderer* mShapeRenderer = nullptr;
     /// Collection of logic gates
     std::vector<std::shared_ptr<Gate>> gates;
     /// Currently grabbed gate
     std::shared_ptr<Gate> mGrabbedGate;
 
 protected:
-    /// Input pins associated with the gate
-    std::vector<PinInput> mInputPins;
-    /// Output pins associated with the gate
-    std::vector<PinOutput> mOutputPins;
+    /// Input pins associated with the gate, in the game's PinPool
+    std::vector<InputPinHandle> mInputPins;
+    /// Output pins associated with the gate, in the game's PinPool
+    std::vector<OutputPinHandle> mOutputPins;
+
+    void AddInputPin();
+    void AddOutputPin();
+    PinInput& InputPin(size_t index);
+    PinOutput& OutputPin(size_t index);
+
+    /**
+     * adds the gate's outline and pin lines to a path, centered on (0, 0)
+     * @param path the path
+     */
+    virtual void AddShape(wxGraphicsPath& path) const = 0;
+
+    /**
+     * draws any labels, centered on (0, 0), in the label font
+     * @param graphics the graphics context
+     */
+    virtual void DrawLabels(wxGraphicsContext* graphics) const {}
 
 public:
     /**
@@ -81,24 +100,21 @@ public:
     Gate(Game* game, const std::wstring& filename) : Item(game, filename)
     {
     }
+    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    DamageRegion::Rect GetBounds() const override;
+
     /**
-     * draws the gate
-     *
-     * @param graphics
+     * @return the phase updating the gate is profiled as
      */
-    virtual void Draw(std::shared_ptr<wxGraphicsContext> graphics) = 0; // Pure virtual function to draw the gate
+    FrameProfiler::Phase GetUpdatePhase() const override { return FrameProfiler::Phase::UpdateGates; }
+
     /**
      * compute gate output
      *
      * virtual function
      */
     virtual States ComputeOutput() = 0; // Pure virtual function to compute the output
-    /**
-     *
-     *
-     * default destructor
-     */
-    virtual ~Gate() = default;
+    virtual ~Gate();
     
     /**
      * getter for x
@@ -144,18 +160,18 @@ public:
     void SetPosition(double x, double y);
 
     /**
-     * get the input pins
+     * get the handles of the input pins
      * 
-     * @return std::vector<PinInput>& 
+     * @return const std::vector<InputPinHandle>& 
      */
-    std::vector<PinInput>& GetInputPins() { return mInputPins; }
+    const std::vector<InputPinHandle>& GetInputPins() const { return mInputPins; }
 
     /**
-     * get the output pins
+     * get the handles of the output pins
      * 
-     * @return std::vector<PinOutput>& 
+     * @return const std::vector<OutputPinHandle>& 
      */
-    std::vector<PinOutput>& GetOutputPins() { return mOutputPins; }
+    const std::vector<OutputPinHandle>& GetOutputPins() const { return mOutputPins; }
 
     /**
     *
@@ -218,10 +234,10 @@ public:
      */
     States ComputeOutput() override;
     /**
-     * Draw for OR
-     * @param graphics
+     * add the OR gate's shape
+     * @param path the path
      */
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    void AddShape(wxGraphicsPath& path) const override;
     /**
      * update pin positions
      *
@@ -244,12 +260,6 @@ public:
     PinInput* GetInputPin(int index);
     ///< Gets a specific output pin
     PinOutput* GetOutputPin();
-     /**
-      *Connect input for pins
-      * @param inputIndex
-      * @param outputPin 
-      */
-    void ConnectInput(int inputIndex, PinOutput* outputPin);
      /**
      * accepts a visitor
      *
@@ -295,10 +305,10 @@ public:
      */
     void SetPosition(double x, double y);
     /**
-     * Draw for AND
-     * @param graphics
+     * add the AND gate's shape
+     * @param path the path
      */
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    void AddShape(wxGraphicsPath& path) const override;
      /**
     * accepts a visitor
     *
@@ -362,10 +372,10 @@ public:
      */
     void SetPosition(double x, double y);
      /**
-     * Draw for NOT
-     * @param graphics
+     * add the NOT gate's shape
+     * @param path the path
      */
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    void AddShape(wxGraphicsPath& path) const override;
     /**
      * get width
      *
@@ -432,10 +442,15 @@ public:
      */
     void SetPosition(double x, double y);
      /**
-     * Draw for NOT
+     * add the SR flip flop's shape
+     * @param path the path
+     */
+    void AddShape(wxGraphicsPath& path) const override;
+     /**
+     * draw the SR flip flop's labels
      * @param graphics
      */
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    void DrawLabels(wxGraphicsContext* graphics) const override;
      /**
      * get width for the gate
      *
@@ -497,10 +512,15 @@ public:
      */
     void SetPosition(double x, double y);
      /**
-     * Draw for D flip flop
+     * add the D flip flop's shape
+     * @param path the path
+     */
+    void AddShape(wxGraphicsPath& path) const override;
+     /**
+     * draw the D flip flop's labels
      * @param graphics
      */
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    void DrawLabels(wxGraphicsContext* graphics) const override;
     /**
      * get width for the gate
      *
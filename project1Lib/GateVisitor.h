@@ -170,153 +170,6 @@ public:
     }
 };
 
-/**
- * visitor for output pin hit test
- *
- */
-class GateOutputPinHitTestVisitor : public ItemVisitor
-{
-private:
-    PinInput* mSelectedInputPin;
-    double mX; ///< x location
-    double mY; ///< y location
-    PinOutput* mSelectedOutputPin; ///< selected output pin
-
-public:
-    GateOutputPinHitTestVisitor(double x, double y)
-        : mX(x), mY(y), mSelectedOutputPin(nullptr)
-    {
-    }
-
-    /**
-     * visit the OR gate
-     *
-     * @param orgate
-     */
-    void VisitORGate(ORGate* orgate) override
-    {
-        for (auto& outputPin : orgate->GetOutputPins())
-        {
-            if (outputPin.HitTest(mX, mY))
-            {
-                mSelectedOutputPin = &outputPin;
-                break;
-            }
-        }
-    }
-
-    /**
-     * visit the AND gate
-     *
-     * @param andgate
-     */
-    void VisitANDGate(ANDGate* andgate) override
-    {
-        for (auto& outputPin : andgate->GetOutputPins())
-        {
-            if (outputPin.HitTest(mX, mY))
-            {
-                mSelectedOutputPin = &outputPin;
-                break;
-            }
-        }
-    }
-
-    /**
-     * visit the NOT gate
-     *
-     * @param notgate
-     */
-
-    void VisitNOTGate(NOTGate* notgate) override
-    {
-        for (auto& outputPin : notgate->GetOutputPins())
-        {
-            if (outputPin.HitTest(mX, mY))
-            {
-                mSelectedOutputPin = &outputPin;
-                break;
-            }
-        }
-    }
-
-    /**
-     * visit the SR flip flop gate
-     *
-     * @param srflip
-     */
-    void VisitSRFlipFlopGate(SRFlipFlopGate* srflip) override
-    {
-        for (auto& outputPin : srflip->GetOutputPins())
-        {
-            if (outputPin.HitTest(mX, mY))
-            {
-                mSelectedOutputPin = &outputPin;
-                break;
-            }
-        }
-    }
-
-    /**
-     *  visit the D flip flop gate
-     *
-     * @param dflip
-     */
-    void VisitDFlipFlopGate(DFlipFlopGate* dflip) override
-    {
-        for (auto& outputPin : dflip->GetOutputPins())
-        {
-            if (outputPin.HitTest(mX, mY))
-            {
-                mSelectedOutputPin = &outputPin;
-                break;
-            }
-        }
-    }
-
-    /**
-     * visit the beam
-     *
-     * @param beam
-     */
-    void VisitBeam(Beam* beam) override
-    {
-        if (beam->GetOutputPin()->HitTest(mX, mY))
-        {
-            mSelectedOutputPin = beam->GetOutputPin();
-        }
-    }
-
-    /**
-     * visit the sparty
-     *
-     * @param sparty
-     */
-
-    void VisitSparty(Sparty* sparty) override
-    {
-        // Check if an output pin is already selected
-        if (mSelectedOutputPin && sparty->GetInputPin()->HitTest(mX, mY))
-        {
-            mSelectedInputPin = sparty->GetInputPin();
-
-            // Connect the selected output pin to Sparty's input pin
-            mSelectedOutputPin->ConnectToInput(mSelectedInputPin);
-        }
-    }
-
-    /**
-     * get the selected output pin
-     *
-     * @return PinOutput*
-     */
-
-    PinOutput* GetSelectedOutputPin() const
-    {
-        return mSelectedOutputPin;
-    }
-};
-
 /**
  * visitor for gate grab
  *
@@ -417,123 +270,4 @@ public:
     }
 };
 
-/**
- * visitor for gate input pin hit test
- *
- */
-class GateInputPinHitTestVisitor : public ItemVisitor
-{
-private:
-    double mX; ///< x location
-    double mY; ///< y location
-    PinInput* mInputPin; ///< input pin
-
-public:
-    /**
-     * constructor
-     *
-     * @param x
-     * @param y
-     */
-    GateInputPinHitTestVisitor(double x, double y)
-        : mX(x), mY(y), mInputPin(nullptr)
-    {
-    }
-
-    /**
-     * visit the OR gate
-     *
-     * @param orgate
-     */
-    void VisitORGate(ORGate* orgate) override
-    {
-        for (auto& inputPin : orgate->GetInputPins())
-        {
-            if (inputPin.HitTest(mX, mY))
-            {
-                mInputPin = &inputPin;
-                break;
-            }
-        }
-    }
-
-    /**
-     * visit the AND gate
-     *
-     * @param andgate
-     */
-    void VisitANDGate(ANDGate* andgate) override
-    {
-        for (auto& inputPin : andgate->GetInputPins())
-        {
-            if (inputPin.HitTest(mX, mY))
-            {
-                mInputPin = &inputPin;
-                break;
-            }
-        }
-    }
-
-    /**
-     * visit the NOT gate
-     *
-     * @param notgate
-     */
-    void VisitNOTGate(NOTGate* notgate) override
-    {
-        for (auto& inputPin : notgate->GetInputPins())
-        {
-            if (inputPin.HitTest(mX, mY))
-            {
-                mInputPin = &inputPin;
-                break;
-            }
-        }
-    }
-
-    /**
-     * visit the SR flip flop gate
-     *
-     * @param srflip
-     */
-    void VisitSRFlipFlopGate(SRFlipFlopGate* srflip) override
-    {
-        for (auto& inputPin : srflip->GetInputPins())
-        {
-            if (inputPin.HitTest(mX, mY))
-            {
-                mInputPin = &inputPin;
-                break;
-            }
-        }
-    }
-
-    /**
-     * visit the D flip flop gate
-     *
-     * @param dflip
-     */
-    void VisitDFlipFlopGate(DFlipFlopGate* dflip) override
-    {
-        for (auto& inputPin : dflip->GetInputPins())
-        {
-            if (inputPin.HitTest(mX, mY))
-            {
-                mInputPin = &inputPin;
-                break;
-            }
-        }
-    }
-
-    /**
-     * get the input pin
-     *
-     * @return PinInput*
-     */
-    PinInput* GetInputPin() const
-    {
-        return mInputPin;
-    }
-};
-
 #endif // GATEVISITOR_H
@@ -4,6 +4,7 @@
  */
 #include "pch.h"
 #include "Item.h"
+#include "ResourceCache.h"
 
 #include <wx/graphics.h>
 
@@ -17,7 +18,7 @@ Item::Item(Game* game, const std::wstring& filename) : mGame(game)
 {
     if (!filename.empty())
     {
-        mItemImage = std::make_unique<wxImage>(filename, wxBITMAP_TYPE_ANY);
+        mItemImage = ResourceCache::Get().GetImage(filename);
     }
     //
     // if (!mItemImage->IsOk())
@@ -72,12 +73,7 @@ bool Item::HitTest(double x, double y)
  */
 void Item::Draw(std::shared_ptr<wxGraphicsContext> graphics)
 {
-    if (mItemBitmap.IsNull())
-    {
-        mItemBitmap = graphics->CreateBitmapFromImage(*mItemImage);
-    }
-
-    graphics->DrawBitmap(mItemBitmap,
+    graphics->DrawBitmap(ResourceCache::Get().GetBitmap(graphics.get(), mItemImage),
                          GetX() - mItemImage->GetWidth() / 2,
                          GetY() - mItemImage->GetHeight() / 2,
                          mItemImage->GetWidth(),
@@ -85,19 +81,33 @@ void Item::Draw(std::shared_ptr<wxGraphicsContext> graphics)
 }
 
 /**
- * destructor
+ * add the areas the item changed since damage was last collected
+ *
+ * If the item moved or changed its look, both where it was and where
+ * it is now need drawing again.
+ *
+ * @param damage the region to add to
  */
-Item::~Item()
+void Item::CollectDamage(DamageRegion& damage)
 {
+    auto bounds = GetBounds();
+    auto look = GetLook();
+    if (!mDamageCollected || bounds != mDrawnBounds || look != mDrawnLook)
+    {
+        if (mDamageCollected)
+        {
+            damage.Add(mDrawnBounds);
+        }
+        damage.Add(bounds);
+        mDrawnBounds = bounds;
+        mDrawnLook = look;
+        mDamageCollected = true;
+    }
 }
 
 /**
- * load the attributes for an item node.
- * @param node the xml node we are loading the item from
+ * destructor
  */
-void Item::XmlLoad(wxXmlNode* node)
+Item::~Item()
 {
-    auto position = node->GetAttribute("p", "0,0");
-    position.BeforeFirst(',').ToDouble(&mX);
-    position.AfterFirst(',').ToDouble(&mY);
 }
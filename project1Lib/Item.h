@@ -11,6 +11,9 @@
 #include <vector>
 
 #include "ItemVisitor.h"
+#include "ResourceCache.h"
+#include "DamageRegion.h"
+#include "FrameProfiler.h"
 
 class Game;
 
@@ -39,16 +42,11 @@ private:
     /// The game this item is contained in
     Game* mGame;
 
-    /// path of the image file
-    std::wstring mPath;
-
     double mX = 0; ///< X location
     double mY = 0; ///< Y location
 
-    /// the item image
-    std::unique_ptr<wxImage> mItemImage;
-    /// the bitmap we can display
-    wxGraphicsBitmap mItemBitmap;
+    /// the item image, shared with every item showing the same file
+    ResourceCache::Image mItemImage;
 
     /// item width
     double mWidth = 0;
@@ -56,6 +54,10 @@ private:
     /// item height
     double mHeight = 0;
 
+    DamageRegion::Rect mDrawnBounds; ///< bounds when damage was last collected
+    size_t mDrawnLook = 0; ///< look when damage was last collected
+    bool mDamageCollected = false; ///< damage has been collected at least once
+
 public:
     /// default constructor (disabled)
     Item() = delete;
@@ -66,7 +68,7 @@ public:
     /**
      * destructor
      */
-    ~Item();
+    virtual ~Item();
 
 
     /**
@@ -101,6 +103,16 @@ public:
 
     virtual void Draw(std::shared_ptr<wxGraphicsContext> graphics);
 
+    /**
+     * draw the parts of the item that never change during play
+     *
+     * These go into the game's static layer, drawn once per level and
+     * window size, underneath what Draw draws every frame.
+     *
+     * @param graphics graphic object
+     */
+    virtual void DrawStatic(std::shared_ptr<wxGraphicsContext> graphics) {}
+
     /**
      * update the item
      *
@@ -112,6 +124,31 @@ public:
 
     virtual bool HitTest(double x, double y);
 
+    /**
+     * the area the item draws in
+     *
+     * Items that do not know theirs are drawn every frame and repaint
+     * the whole game when their look changes.
+     *
+     * @return the bounds in virtual pixels, DamageRegion::Everything if unknown
+     */
+    virtual DamageRegion::Rect GetBounds() const { return DamageRegion::Everything; }
+
+    /**
+     * a value that changes whenever the item looks different without
+     * its bounds changing, such as a scrolling belt or a beam turning red
+     *
+     * @return the look
+     */
+    virtual size_t GetLook() const { return 0; }
+
+    /**
+     * @return the phase the time spent updating the item is profiled as
+     */
+    virtual FrameProfiler::Phase GetUpdatePhase() const { return FrameProfiler::Phase::UpdateOther; }
+
+    void CollectDamage(DamageRegion& damage);
+
     /**
      * getter for width
      * @return width
@@ -123,7 +160,16 @@ public:
      */
     double GetHeight() { return mHeight; }
 
-    void XmlLoad(wxXmlNode* node);
+    /**
+     * set the location loaded from the level, without any SetLocation override
+     * @param x x location
+     * @param y y location
+     */
+    void SetPosition(double x, double y)
+    {
+        mX = x;
+        mY = y;
+    }
 };
 
 
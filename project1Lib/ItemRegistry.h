@@ -0,0 +1,118 @@
+/**
+ * @file ItemRegistry.h
+ * @author Yeji Lee
+ *
+ *
+ */
+
+#ifndef ITEMREGISTRY_H
+#define ITEMREGISTRY_H
+
+#include <vector>
+
+class Beam;
+class Sparty;
+class Product;
+class Conveyor;
+class Gate;
+class Sensor;
+
+/**
+ * per-kind indexes into the items of the game
+ *
+ * Game still owns every item through its single item list. These
+ * are non-owning pointers grouped by kind, so code that only needs
+ * the beams or the spartys does not have to visit every item.
+ */
+class ItemRegistry
+{
+private:
+    std::vector<Beam*> mBeams; ///< beams in the game
+    std::vector<Sparty*> mSpartys; ///< spartys in the game
+    std::vector<Product*> mProducts; ///< products in the game
+    std::vector<Conveyor*> mConveyors; ///< conveyors in the game
+    std::vector<Gate*> mGates; ///< gates of every type in the game
+    std::vector<Sensor*> mSensors; ///< sensors in the game
+
+public:
+    /**
+     * add a beam to the registry
+     * @param beam the beam
+     */
+    void Add(Beam* beam) { mBeams.push_back(beam); }
+
+    /**
+     * add a sparty to the registry
+     * @param sparty the sparty
+     */
+    void Add(Sparty* sparty) { mSpartys.push_back(sparty); }
+
+    /**
+     * add a product to the registry
+     * @param product the product
+     */
+    void Add(Product* product) { mProducts.push_back(product); }
+
+    /**
+     * add a conveyor to the registry
+     * @param conveyor the conveyor
+     */
+    void Add(Conveyor* conveyor) { mConveyors.push_back(conveyor); }
+
+    /**
+     * add a gate to the registry
+     * @param gate the gate
+     */
+    void Add(Gate* gate) { mGates.push_back(gate); }
+
+    /**
+     * add a sensor to the registry
+     * @param sensor the sensor
+     */
+    void Add(Sensor* sensor) { mSensors.push_back(sensor); }
+
+    /**
+     * remove everything from the registry
+     */
+    void Clear()
+    {
+        mBeams.clear();
+        mSpartys.clear();
+        mProducts.clear();
+        mConveyors.clear();
+        mGates.clear();
+        mSensors.clear();
+    }
+
+    /**
+     * @return the beams
+     */
+    const std::vector<Beam*>& GetBeams() const { return mBeams; }
+
+    /**
+     * @return the spartys
+     */
+    const std::vector<Sparty*>& GetSpartys() const { return mSpartys; }
+
+    /**
+     * @return the products
+     */
+    const std::vector<Product*>& GetProducts() const { return mProducts; }
+
+    /**
+     * @return the conveyors
+     */
+    const std::vector<Conveyor*>& GetConveyors() const { return mConveyors; }
+
+    /**
+     * @return the gates
+     */
+    const std::vector<Gate*>& GetGates() const { return mGates; }
+
+    /**
+     * @return the sensors
+     */
+    const std::vector<Sensor*>& GetSensors() const { return mSensors; }
+};
+
+#endif //ITEMREGISTRY_H
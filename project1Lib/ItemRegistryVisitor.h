@@ -0,0 +1,115 @@
+/**
+ * @file ItemRegistryVisitor.h
+ * @author Yeji Lee
+ *
+ *
+ */
+
+#ifndef ITEMREGISTRYVISITOR_H
+#define ITEMREGISTRYVISITOR_H
+
+#include "ItemVisitor.h"
+#include "ItemRegistry.h"
+#include "Gate.h"
+#include "Sensor.h"
+#include "Beam.h"
+#include "Sparty.h"
+
+/**
+ * visitor that files an item into the per-kind registry
+ *
+ */
+class ItemRegistryVisitor : public ItemVisitor
+{
+private:
+    ItemRegistry* mRegistry; ///< registry the item is added to
+
+    /**
+     * add a gate
+     *
+     * @param gate the gate
+     */
+    void AddGate(Gate* gate) { mRegistry->Add(gate); }
+
+public:
+    /**
+     * constructor
+     *
+     * @param registry the registry to add items to
+     */
+    ItemRegistryVisitor(ItemRegistry* registry) : mRegistry(registry)
+    {
+    }
+
+    /**
+     * visit a product
+     *
+     * @param product the product
+     */
+    void VisitProduct(Product* product) override { mRegistry->Add(product); }
+
+    /**
+     * visit a conveyor
+     *
+     * @param conveyor the conveyor
+     */
+    void VisitConveyor(Conveyor* conveyor) override { mRegistry->Add(conveyor); }
+
+    /**
+     * visit a beam
+     *
+     * @param beam the beam
+     */
+    void VisitBeam(Beam* beam) override { mRegistry->Add(beam); }
+
+    /**
+     * visit a sparty
+     *
+     * @param sparty the sparty
+     */
+    void VisitSparty(Sparty* sparty) override { mRegistry->Add(sparty); }
+
+    /**
+     * visit a sensor
+     *
+     * @param sensor the sensor
+     */
+    void VisitSensor(Sensor* sensor) override { mRegistry->Add(sensor); }
+
+    /**
+     * visit the OR gate
+     *
+     * @param orgate the gate
+     */
+    void VisitORGate(ORGate* orgate) override { AddGate(orgate); }
+
+    /**
+     * visit the AND gate
+     *
+     * @param andgate the gate
+     */
+    void VisitANDGate(ANDGate* andgate) override { AddGate(andgate); }
+
+    /**
+     * visit the NOT gate
+     *
+     * @param notgate the gate
+     */
+    void VisitNOTGate(NOTGate* notgate) override { AddGate(notgate); }
+
+    /**
+     * visit the SR flip flop gate
+     *
+     * @param srflip the gate
+     */
+    void VisitSRFlipFlopGate(SRFlipFlopGate* srflip) override { AddGate(srflip); }
+
+    /**
+     * visit the D flip flop gate
+     *
+     * @param dflip the gate
+     */
+    void VisitDFlipFlopGate(DFlipFlopGate* dflip) override { AddGate(dflip); }
+};
+
+#endif //ITEMREGISTRYVISITOR_H
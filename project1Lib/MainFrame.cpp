@@ -7,6 +7,8 @@
 #include "MainFrame.h"
 #include "GameView.h"
 #include "ids.h"
+#include "Game.h"
+#include "ResourceCache.h"
 /**
  * @brief Initializes the main application window.
  *
@@ -53,6 +55,7 @@ void MainFrame::Initialize()
     // File,Help,and Level Selection menu items
     fileMenu->Append(wxID_EXIT, "E&xit\tAlt-X", "Quit this program");
     helpMenu->Append(wxID_ABOUT, "&About\tF1", "Show about dialog");
+    helpMenu->Append(IDM_MEMORY_REPORT, L"&Memory Report", L"Show the image memory of this level");
     levelMenu->Append(IDM_LEVEL0, L"Level 0", L"Select Level 0");
     levelMenu->Append(IDM_LEVEL1, L"Level 1", L"Select Level 1");
     levelMenu->Append(IDM_LEVEL2, L"Level 2", L"Select Level 2");
@@ -68,8 +71,11 @@ void MainFrame::Initialize()
     gateMenu->Append(ID_NOTGate, "Add NOT Gate");
     gateMenu->Append(IDM_SRFLIP_GATE, "Add SR-Flip Flop Gate");
     gateMenu->Append(IDM_DRFLIP_GATE, "Add D-Flip Flop Gate");
+    gateMenu->AppendSeparator();
+    gateMenu->Append(IDM_CHECK_CIRCUIT, L"&Check Circuit", L"Check if the circuit sorts every product of the level");
     // View menu item to toggle control points display
     mControlPointsMenuItem = viewMenu->AppendCheckItem(wxID_ANY, "Show Control Points", "Toggle display of Bézier curve control points");
+    viewMenu->AppendCheckItem(IDM_PROFILER, L"Frame &Profiler", L"Show where the time of each frame goes");
 
     SetMenuBar(menuBar);
     CreateStatusBar(1, wxSTB_SIZEGRIP, wxID_ANY);
@@ -81,8 +87,11 @@ void MainFrame::Initialize()
     Bind(wxEVT_COMMAND_MENU_SELECTED, &MainFrame::OnAddDFlipFlopGate, this, IDM_DRFLIP_GATE);
     Bind(wxEVT_COMMAND_MENU_SELECTED, &MainFrame::OnExit, this, wxID_EXIT);
     Bind(wxEVT_COMMAND_MENU_SELECTED, &MainFrame::OnAbout, this, wxID_ABOUT);
+    Bind(wxEVT_COMMAND_MENU_SELECTED, &MainFrame::OnMemoryReport, this, IDM_MEMORY_REPORT);
     Bind(wxEVT_CLOSE_WINDOW, &MainFrame::OnClose, this);
     Bind(wxEVT_MENU, &MainFrame::OnToggleControlPoints, this, mControlPointsMenuItem->GetId());
+    Bind(wxEVT_MENU, &MainFrame::OnToggleProfiler, this, IDM_PROFILER);
+    Bind(wxEVT_COMMAND_MENU_SELECTED, &MainFrame::OnCheckCircuit, this, IDM_CHECK_CIRCUIT);
 }
 /**
  * @brief Toggles the display of control points in the GameView.
@@ -93,6 +102,14 @@ void MainFrame::OnToggleControlPoints(wxCommandEvent& event)
     mGameView->ToggleControlPoints();
     mGameView->Refresh();
 }
+/**
+ * @brief Toggles the frame profiler overlay and status bar readout in the GameView.
+ * @param event wxCommandEvent object containing event details.
+ */
+void MainFrame::OnToggleProfiler(wxCommandEvent& event)
+{
+    mGameView->ToggleProfiler();
+}
 /**
  * @brief Event handler for adding an OR gate to the GameView.
  * @param event wxCommandEvent object containing event details.
@@ -169,6 +186,44 @@ void MainFrame::OnAbout(wxCommandEvent &event)
                  this);
 }
 
+/**
+ * Handles Memory Report item event from menu.
+ * Shows the image memory the items of the current level hold, and
+ * what it would be if each item decoded its own images.
+ * @param event The event object associated with the Memory Report action.
+ */
+void MainFrame::OnMemoryReport(wxCommandEvent &event)
+{
+    auto usage = ResourceCache::Get().GetUsage();
+    auto kilobytes = [](size_t bytes) { return (bytes + 1023) / 1024; };
+
+    wxString report = wxString::Format(
+        L"Level %d: %zu items\n\n"
+        L"%zu images shared by %zu users: %zu KB\n"
+        L"One image per user would take: %zu KB\n"
+        L"All cached images: %zu KB",
+        mGameView->GetGame()->GetCurrentLevel(), mGameView->GetGame()->GetItemSize(),
+        usage.mImages, usage.mUsers, kilobytes(usage.mBytes),
+        kilobytes(usage.mUnsharedBytes),
+        kilobytes(usage.mCachedBytes));
+
+    wxMessageBox(report, L"Memory Report", wxOK, this);
+}
+
+/**
+ * Handles Check Circuit item event from menu.
+ * Runs every product of the level through the circuit as wired, without
+ * playing the level, and says whether each would be sorted correctly.
+ * @param event The event object associated with the Check Circuit action.
+ */
+void MainFrame::OnCheckCircuit(wxCommandEvent &event)
+{
+    auto message = mGameView->GetGame()->CircuitSortsProducts() ?
+                   L"The circuit kicks exactly the products it should." :
+                   L"The circuit does not sort every product correctly yet.";
+    wxMessageBox(message, L"Check Circuit", wxOK, this);
+}
+
 /**
  * Handle a close event. Stop the animation and destroy this window.
  * @param event The Close event
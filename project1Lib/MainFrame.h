@@ -45,6 +45,12 @@ public:
  */
     void OnAbout(wxCommandEvent& event);
     /**
+ * @brief Event handler for displaying the image memory report of the level.
+ *
+ * @param event wxCommandEvent object containing event details.
+ */
+    void OnMemoryReport(wxCommandEvent& event);
+    /**
  * @brief Event handler for handling the frame's close event.
  *
  * Ensures that resources are properly cleaned up and prompts the user if necessary.
@@ -89,6 +95,18 @@ public:
  */
     void OnToggleControlPoints(wxCommandEvent& event);
    /**
+ * @brief Toggles the frame profiler overlay and status bar readout.
+ *
+ * @param event wxCommandEvent object containing event details.
+ */
+    void OnToggleProfiler(wxCommandEvent& event);
+   /**
+ * @brief Checks whether the circuit as wired sorts every product of the level.
+ *
+ * @param event wxCommandEvent object containing event details.
+ */
+    void OnCheckCircuit(wxCommandEvent& event);
+   /**
     * @enum GateIDs
     * @brief Enumerates custom IDs for gate menu items.
     */
@@ -11,6 +11,7 @@
 
 #include "Pins.h"
 #include "States.h"
+#include "SlotMap.h"
 
 class Pin;
 class PinOutput;
@@ -24,12 +25,6 @@ class Gate;
 class PinInput : public Pins
 {
 private:
-    ///< Pointer to the connected output pin, if any
-    PinOutput* mConnectedPin = nullptr;
-    ///< Pointer to an output pin for direct connection
-    PinOutput* mConnection = nullptr;
-    ///< List of connected output pins
-    std::vector<PinOutput*> mConnectedPins; // Connected output pins
     ///< The current state of the input pin
     States mCurrentState = States::Unknown;
 
@@ -48,18 +43,6 @@ public:
      * @param graphics A shared pointer to the graphics context for rendering.
      */
     void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
-    /**
-     * @brief Gets the pin to which this input is currently connected.
-     *
-     * @return A pointer to the connected PinOutput, or nullptr if no connection exists.
-     */
-    PinOutput* GetConnectedPin() const { return mConnectedPin; }
-    /**
-     * @brief Connects this input pin to a specified output pin.
-     *
-     * @param pin The PinOutput object to connect to this input.
-     */
-    void ConnectToOutput(PinOutput* pin);
  ///static const int
     static const int DefaultLineLength = 20;
  /**
@@ -76,18 +59,6 @@ public:
  * @param y
  */
     void OnDrag(double x, double y) override{}
- /**
-     * @brief get connected gate
-     */
-    Gate* GetConnectedGate() const;
- /**
-     * @brief pin output
-     */
-    void SetConnection(PinOutput* outputPin);
- /**
-     * has connection
-     */
-    bool HasConnection() const { return mConnectedPin != nullptr; }
  /**
      * get current state
      */
@@ -99,7 +70,9 @@ public:
   */
     void SetCurrentState(States state) { mCurrentState = state; }
 
- const std::vector<PinOutput*>& GetConnectedPins() const {return mConnectedPins;}
 };
 
+/// Handle to an input pin in a PinPool
+typedef SlotHandle<PinInput> InputPinHandle;
+
 #endif // PININPUT_H
\ No newline at end of file
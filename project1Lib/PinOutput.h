@@ -14,6 +14,7 @@
 #include <vector>
 #include <wx/colour.h>
 #include "States.h"
+#include "SlotMap.h"
 
 class Gate;
 class PinInput;
@@ -25,14 +26,6 @@ class PinInput;
 class PinOutput : public Pins
 {
 private:
-    /// The input pins this output is connected to
-    std::vector<PinInput*> mConnectedPins;
-    /// Maximum offset of Bezier control points relative to line ends
-    static constexpr double BezierMaxOffset = 200;
-    /// Line width for drawing lines between pins
-    static const int LineWidth = 3;
-    /// The connections for pin input
-    std::vector<PinInput*> mConnections;
     /// The variable for dragging wire
     bool mDragging = false;
     /// parent gate variable
@@ -58,27 +51,6 @@ public:
      * @param y The y-coordinate of the drag position.
      */
     void OnDrag(double x, double y) override;
-     /**
-     * Connects this output pin to an input pin.
-     * @param pin Pointer to the input pin to connect.
-     */
-    void ConnectToInput(PinInput* pin);
-    /**
-     * Disconnects this output pin from an input pin.
-     * @param pin Pointer to the input pin to disconnect from.
-     */
-    void DisconnectFrom(PinInput* pin);
-    /**
-    * Draws the connection between this output pin and an input pin.
-    * @param graphics A shared pointer to the wxGraphicsContext for drawing the connection.
-    * @param inputPin Pointer to the input pin to which the connection is drawn.
-    */
-    void DrawConnection(std::shared_ptr<wxGraphicsContext> graphics, PinInput* inputPin);
-    /**
-    * Adds a connection to an input pin.
-    * @param connection Pointer to the input pin to add to the connection list.
-    */
-    void AddConnection(PinInput* connection) { mConnectedPins.push_back(connection); }
     /**
     * Tests if a given point is within the area of the pin.
     * @param x The x-coordinate of the point to test.
@@ -127,10 +99,6 @@ public:
      * @return The wxColour representing the unknown state.
      */
     static const wxColour& GetConnectionColorUnknown() { return ConnectionColorUnknown; }
-     /**
-     * Updates the state of this output pin and propagates the change to connected pins.
-     */
-    void UpdateState();
  /// Static color representing a zero (low) connection state.
     static const wxColour ConnectionColorZero; // Black
  /// Static color representing a one
@@ -139,11 +107,9 @@ public:
     static const wxColour ConnectionColorUnknown;
  /// Static color representing unkown state
     States mCurrentState = States::Unknown;
-    /**
-     * Gets a list of input pins connected to this output pin.
-     * @return A constant reference to a vector of pointers to connected PinInput objects.
-     */
-    const std::vector<PinInput*>& GetConnectedPins() const { return mConnectedPins; }
 };
 
+/// Handle to an output pin in a PinPool
+typedef SlotHandle<PinOutput> OutputPinHandle;
+
 #endif // PINOUTPUT_H
@@ -0,0 +1,101 @@
+/**
+ * @file PinPool.cpp
+ * @author Yeji Lee
+ */
+
+#include "pch.h"
+#include "PinPool.h"
+
+/**
+ * add an unwired input pin
+ *
+ * @return handle to the pin
+ */
+InputPinHandle PinPool::AddInput()
+{
+    auto handle = mInputs.Add();
+    mInputs.Get(handle)->SetId(handle.GetSlot());
+    mNetlist.Resize(mOutputs.GetSlotCount(), mInputs.GetSlotCount());
+    return handle;
+}
+
+/**
+ * add an unwired output pin
+ *
+ * @return handle to the pin
+ */
+OutputPinHandle PinPool::AddOutput()
+{
+    auto handle = mOutputs.Add();
+    mOutputs.Get(handle)->SetId(handle.GetSlot());
+    mNetlist.Resize(mOutputs.GetSlotCount(), mInputs.GetSlotCount());
+    return handle;
+}
+
+/**
+ * remove an input pin and the wire into it
+ *
+ * Stale handles, including those of a pool that has since been
+ * cleared, are ignored.
+ *
+ * @param handle handle to the pin
+ */
+void PinPool::Remove(InputPinHandle handle)
+{
+    if (mInputs.Remove(handle))
+    {
+        mNetlist.RemoveInput(handle.GetSlot());
+    }
+}
+
+/**
+ * remove an output pin and every wire out of it
+ *
+ * @param handle handle to the pin
+ */
+void PinPool::Remove(OutputPinHandle handle)
+{
+    if (mOutputs.Remove(handle))
+    {
+        mNetlist.RemoveOutput(handle.GetSlot());
+    }
+}
+
+/**
+ * wire an output pin to an input pin
+ *
+ * @param output the output pin
+ * @param input the input pin
+ */
+void PinPool::Connect(const PinOutput* output, const PinInput* input)
+{
+    if (GetOutput(output->GetId()) == output && GetInput(input->GetId()) == input)
+    {
+        mNetlist.Connect(output->GetId(), input->GetId());
+    }
+}
+
+/**
+ * remove the wire from an output pin to an input pin
+ *
+ * @param output the output pin
+ * @param input the input pin
+ */
+void PinPool::Disconnect(const PinOutput* output, const PinInput* input)
+{
+    if (GetOutput(output->GetId()) == output && GetInput(input->GetId()) == input)
+    {
+        mNetlist.Disconnect(output->GetId(), input->GetId());
+    }
+}
+
+/**
+ * remove every pin and wire
+ */
+void PinPool::Clear()
+{
+    mInputs.Clear();
+    mOutputs.Clear();
+    mNetlist.Clear();
+    mNetlist.Resize(mOutputs.GetSlotCount(), mInputs.GetSlotCount());
+}
@@ -0,0 +1,86 @@
+/**
+ * @file PinPool.h
+ * @author Yeji Lee
+ *
+ *
+ */
+
+#ifndef PINPOOL_H
+#define PINPOOL_H
+
+#include "SlotMap.h"
+#include "Netlist.h"
+#include "PinInput.h"
+#include "PinOutput.h"
+
+/**
+ * every pin in the game, and the wires between them
+ *
+ * Items do not own their pins. They allocate them here and keep the
+ * handles, so a pin can be found in constant time whatever happens to
+ * the item, and removing an item's pins also removes their wires. The
+ * slot of a pin's handle is its ID in the Netlist.
+ */
+class PinPool
+{
+private:
+    SlotMap<PinInput> mInputs; ///< the input pins
+    SlotMap<PinOutput> mOutputs; ///< the output pins
+    Netlist mNetlist; ///< wires between the pins, by slot
+
+public:
+    InputPinHandle AddInput();
+    OutputPinHandle AddOutput();
+    void Remove(InputPinHandle handle);
+    void Remove(OutputPinHandle handle);
+    void Connect(const PinOutput* output, const PinInput* input);
+    void Disconnect(const PinOutput* output, const PinInput* input);
+    void Clear();
+
+    /**
+     * @param handle handle to an input pin
+     * @return the pin, nullptr if it was removed
+     */
+    PinInput* Get(InputPinHandle handle) { return mInputs.Get(handle); }
+
+    /**
+     * @param handle handle to an output pin
+     * @return the pin, nullptr if it was removed
+     */
+    PinOutput* Get(OutputPinHandle handle) { return mOutputs.Get(handle); }
+
+    /**
+     * @param id netlist ID of an input pin
+     * @return the pin, nullptr if there is none
+     */
+    PinInput* GetInput(uint32_t id) { return mInputs.GetAt(id); }
+
+    /**
+     * @param id netlist ID of an output pin
+     * @return the pin, nullptr if there is none
+     */
+    PinOutput* GetOutput(uint32_t id) { return mOutputs.GetAt(id); }
+
+    /**
+     * @param pin an output pin in the pool
+     * @return a handle to it, to keep in place of the pointer
+     */
+    OutputPinHandle GetHandle(const PinOutput* pin) const { return mOutputs.GetHandleAt(pin->GetId()); }
+
+    /**
+     * @return the input pins, packed together in no particular order
+     */
+    SlotMap<PinInput>& GetInputs() { return mInputs; }
+
+    /**
+     * @return the output pins, packed together in no particular order
+     */
+    SlotMap<PinOutput>& GetOutputs() { return mOutputs; }
+
+    /**
+     * @return the wires between the pins
+     */
+    const Netlist& GetNetlist() const { return mNetlist; }
+};
+
+#endif //PINPOOL_H
@@ -12,6 +12,7 @@
 #include <wx/graphics.h>
 #include "IDraggable.h"
 #include <memory>
+#include <cstdint>
 
 class Pins;  // Forward declaration
 
@@ -38,6 +39,8 @@ protected:
 
  /// The default length of the line from the pin
  static const int DefaultLineLength = 20;
+ /// ID of the pin in the game's netlist, numbered separately for inputs and outputs
+ uint32_t mId = UINT32_MAX;
 
 public:
  /// Constructor
@@ -87,6 +90,16 @@ public:
   * @return Y coordinate as a double.
   */
  double GetY() const { return mY; }
+ /**
+  * @brief Retrieves the netlist ID of the pin.
+  * @return the ID, UINT32_MAX if the pin is not in a game
+  */
+ uint32_t GetId() const { return mId; }
+ /**
+  * @brief Sets the netlist ID of the pin.
+  * @param id the ID
+  */
+ void SetId(uint32_t id) { mId = id; }
 };
 
 #endif // PINS_H
@@ -7,9 +7,9 @@
 #include "pch.h"
 #include "Product.h"
 
-#include "BeamVisitor.h"
 #include "Conveyor.h"
 #include "Game.h"
+#include "ResourceCache.h"
 
 
 /**
@@ -27,11 +27,6 @@ const wxColour MSUGreen(24, 69, 59);
  */
 const wxColor UofMBlue(0, 39, 76);
 
-/// Delay after last product has left beam or
-/// been kicked before we end the level.
-const double LastProductDelay = 3;
-
-
 const std::map<std::wstring, Product::Properties> Product::NamesToProperties = {
     {L"red", Product::Properties::Red},
     {L"green", Product::Properties::Green},
@@ -81,9 +76,15 @@ const std::map<Product::Properties, std::wstring> Product::PropertiesToContentIm
  * @param kick whether the product should be kicked
  */
 Product::Product(Game* game, int placement, Properties shape, Properties color, Properties content, bool kick)
-    : Item(game, L""), mPlacement(placement), mShape(shape), mColor(color), mContent(content), mKick(kick), mX(0), mY(0)
+    : Item(game, L"")
 {
-    mWidth = ProductDefaultSize;
+    mModel = std::make_shared<ProductModel>(placement, shape, color, content, kick);
+
+    auto image = PropertiesToContentImages.find(content);
+    if (image != PropertiesToContentImages.end())
+    {
+        mContentImage = ResourceCache::Get().GetImage(image->second);
+    }
 }
 
 
@@ -99,12 +100,14 @@ void Product::Draw(std::shared_ptr<wxGraphicsContext> graphics)
         return;
     }
 
-    double size = mWidth;
-    double halfSize = mWidth / 2;
+    double size = mModel->GetWidth();
+    double halfSize = size / 2;
+    int x = GetX();
+    int y = GetY();
 
     //color
     wxBrush brush;
-    switch (mColor)
+    switch (mModel->GetColor())
     {
     case Properties::Red:
         brush = wxBrush(OhioStateRed);
@@ -122,22 +125,22 @@ void Product::Draw(std::shared_ptr<wxGraphicsContext> graphics)
     graphics->SetBrush(brush);
     graphics->SetPen(*wxBLACK_PEN);
 
-    switch (mShape)
+    switch (mModel->GetShape())
     {
     case Properties::Square:
-        graphics->DrawRectangle(mX - halfSize, mY - halfSize, size, size);
+        graphics->DrawRectangle(x - halfSize, y - halfSize, size, size);
         break;
     case Properties::Circle:
-        graphics->DrawEllipse(mX - halfSize, mY - halfSize, size, size);
+        graphics->DrawEllipse(x - halfSize, y - halfSize, size, size);
         break;
     case Properties::Diamond:
         {
             double diamondHalfSize = halfSize * 1.4;
             auto path = graphics->CreatePath();
-            path.MoveToPoint(mX, mY - diamondHalfSize);
-            path.AddLineToPoint(mX + diamondHalfSize, mY);
-            path.AddLineToPoint(mX, mY + diamondHalfSize);
-            path.AddLineToPoint(mX - diamondHalfSize, mY);
+            path.MoveToPoint(x, y - diamondHalfSize);
+            path.AddLineToPoint(x + diamondHalfSize, y);
+            path.AddLineToPoint(x, y + diamondHalfSize);
+            path.AddLineToPoint(x - diamondHalfSize, y);
             path.CloseSubpath();
             graphics->DrawPath(path);
         }
@@ -147,25 +150,32 @@ void Product::Draw(std::shared_ptr<wxGraphicsContext> graphics)
         break;
     }
 
-    if (mContent != Properties::None)
+    if (mContentImage)
     {
-        auto it = Product::PropertiesToContentImages.find(mContent);
-        if (it != Product::PropertiesToContentImages.end())
-        {
-            if (!mContentImage)
-            {
-                mContentImage = std::make_unique<wxImage>(it->second);
-                mContentBitmap = graphics->CreateBitmapFromImage(*mContentImage);
-            }
-            double contentSize = size * mContentScale;
-            double contentOffset = (size - contentSize) / 2;
-
-            graphics->DrawBitmap(mContentBitmap, mX - halfSize + contentOffset, mY - halfSize + contentOffset,
-                                 contentSize, contentSize);
-        }
+        double contentSize = size * mContentScale;
+        double contentOffset = (size - contentSize) / 2;
+
+        graphics->DrawBitmap(ResourceCache::Get().GetBitmap(graphics.get(), mContentImage),
+                             x - halfSize + contentOffset, y - halfSize + contentOffset,
+                             contentSize, contentSize);
     }
 }
 
+/**
+ * the area the product draws in
+ *
+ * A diamond reaches furthest, its corners 1.4 half sizes from the center.
+ *
+ * @return the bounds in virtual pixels
+ */
+DamageRegion::Rect Product::GetBounds() const
+{
+    double reach = mModel->GetWidth() / 2 * 1.4 + 1;
+    double x = GetX();
+    double y = GetY();
+    return {x - reach, y - reach, x + reach, y + reach};
+}
+
 /**
  * update the product
  * 
@@ -173,38 +183,9 @@ void Product::Draw(std::shared_ptr<wxGraphicsContext> graphics)
  */
 void Product::Update(double elapsed)
 {
-    if (mKick)
-    {
-        mX -= mKickSpeed * elapsed;
-    }
-
-    if (mIsOnConveyor && mConveyor != nullptr && mConveyor->IsRunning())
-        MoveDown(mConveyor->GetSpeed() * elapsed);
-
-    BeamVisitor beamVisitor;
-    for (const auto& item : GetGame()->GetItems())
+    if (mModel->Update(elapsed))
     {
-        item->Accept(&beamVisitor);
-    }
-
-    for (auto beam : beamVisitor.GetBeams())
-    {
-        if (beam->IsIntersecting(this))
-        {
-            SetPassedBeam(true);
-            HasPassedBeam();
-            break;
-        }
-    }
-
-    if (mLastProductDelay > 0)
-    {
-        mLastProductDelay -= elapsed;
-        if (mLastProductDelay <= 0)
-        {
-            mLastProductDelay = 0;
-            GetGame()->SetState(Game::GameState::Ending);
-        }
+        GetGame()->SetState(Game::GameState::Ending);
     }
 }
 
@@ -216,20 +197,17 @@ void Product::Update(double elapsed)
  */
 void Product::SetKicked(bool kicked, double kickSpeed)
 {
-    mKick = kicked;
-    mKickSpeed = kickSpeed;
+    mModel->SetKicked(kicked, kickSpeed);
 }
 
 /**
  * set the product to be on the conveyor
  * 
  * @param onConveyor whether the product is on the conveyor
- * @param conveyorSpeed the speed of the conveyor
  */
-void Product::SetOnConveyor(bool onConveyor, double conveyorSpeed)
+void Product::SetOnConveyor(bool onConveyor)
 {
-    mIsOnConveyor = onConveyor;
-    mConveyorSpeed = conveyorSpeed;
+    mModel->SetOnConveyor(onConveyor);
 }
 
 
@@ -240,7 +218,7 @@ void Product::SetOnConveyor(bool onConveyor, double conveyorSpeed)
  */
 int Product::GetPlacement() const
 {
-    return mPlacement;
+    return mModel->GetPlacement();
 }
 
 /**
@@ -250,7 +228,7 @@ int Product::GetPlacement() const
  */
 Product::Properties Product::GetShape() const
 {
-    return mShape;
+    return mModel->GetShape();
 }
 
 /**
@@ -260,7 +238,7 @@ Product::Properties Product::GetShape() const
  */
 Product::Properties Product::GetColor() const
 {
-    return mColor;
+    return mModel->GetColor();
 }
 
 /**
@@ -270,7 +248,7 @@ Product::Properties Product::GetColor() const
  */
 bool Product::ShouldKick() const
 {
-    return mKick;
+    return mModel->ShouldKick();
 }
 
 /**
@@ -281,10 +259,7 @@ bool Product::ShouldKick() const
  */
 void Product::SetLocation(int x, int y)
 {
-    mInitialX = x;
-    mInitialY = y;
-    mX = x;
-    mY = y;
+    mModel->SetLocation(x, y);
 }
 
 /**
@@ -292,19 +267,26 @@ void Product::SetLocation(int x, int y)
  */
 void Product::ResetPosition()
 {
-    mX = mInitialX;
-    mY = mInitialY;
+    mModel->ResetPosition();
 }
 
 /**
- * Logic for after the product passes the beam
+ * set the conveyor the product is on
+ * 
+ * @param conveyor the conveyor the product is on
  */
-void Product::HasPassedBeam()
+void Product::SetConveyor(Conveyor* conveyor)
 {
-    if (mLast)
-    {
-        mLastProductDelay = LastProductDelay;
-    }
-    // Scoring
+    mModel->SetConveyor(conveyor != nullptr ? conveyor->GetModel().get() : nullptr);
 }
 
+/**
+ * check if the product is on the conveyor
+ * 
+ * @param conveyor the conveyor to check
+ * @return true if the product is on the conveyor
+ */
+bool Product::IsOnConveyor(const Conveyor* conveyor) const
+{
+    return mModel->IsOnConveyor(conveyor != nullptr ? conveyor->GetModel().get() : nullptr);
+}
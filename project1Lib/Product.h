@@ -13,12 +13,10 @@
 #include <string>
 #include <Sparty.h>
 #include "Item.h"
+#include "ProductModel.h"
 
 class Conveyor;
 
-/// Default product size in pixels
-const double ProductDefaultSize = 80.0;
-
 /// Size to draw content relative to the product size
 const double ContentScale = 0.8;
 
@@ -29,20 +27,11 @@ const double ContentScale = 0.8;
 class Product : public Item
 {
 public:
-    /**
-     * possible product properties
-     * None property allows to indicate that the product has no content
-     */
-    enum class Properties
-    {
-        None, Red, Green, Blue, White, Square, Circle, Diamond,
-        Izzo, Smith, Football, Basketball
-    };
+    /// possible product properties, shared with the simulation model
+    using Properties = ProductModel::Properties;
 
-    /**
-     * property types
-     */
-    enum class Types { Color, Shape, Content };
+    /// property types
+    using Types = ProductModel::Types;
 
     /// maps for product properties
     static const std::map<Properties, Types> PropertiesToTypes;
@@ -82,38 +71,32 @@ public:
 
     void Update(double elapsed) override;
     void SetKicked(bool kicked, double kickSpeed);
-    void SetOnConveyor(bool onConveyor, double conveyorSpeed);
+    void SetOnConveyor(bool onConveyor);
 
     void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    DamageRegion::Rect GetBounds() const override;
 
     /**
-     * get the width of the product
-     * 
-     * @return double the width of the product 
+     * @return the phase updating the product is profiled as
      */
-    double GetWidth() const { return mWidth; }
+    FrameProfiler::Phase GetUpdatePhase() const override { return FrameProfiler::Phase::UpdateProducts; }
 
     /**
-     * get the content of the product
+     * get the width of the product
      * 
-     * @param conveyor the conveyor the product is on
+     * @return double the width of the product 
      */
-    void SetConveyor(Conveyor* conveyor) { mConveyor = conveyor; }
+    double GetWidth() const { return mModel->GetWidth(); }
 
-    /**
-     * check if the product is on the conveyor
-     * 
-     * @param conveyor the conveyor to check
-     * @return true if the product is on the conveyor
-     */
-    bool IsOnConveyor(const Conveyor* conveyor) const { return mConveyor == conveyor; }
+    void SetConveyor(Conveyor* conveyor);
+    bool IsOnConveyor(const Conveyor* conveyor) const;
 
     /**
      * moves the product down
      * 
      * @param distance the distance to move the product 
      */
-    void MoveDown(double distance) { mY += distance; }
+    void MoveDown(double distance) { mModel->MoveDown(distance); }
 
 
     void SetLocation(int x, int y) override;
@@ -124,28 +107,28 @@ public:
      *
      * @return int
      */
-    int GetX() const { return mX; }
+    int GetX() const { return mModel->GetX(); }
 
     /**
      * getter of y location
      * 
      * @return int 
      */
-    int GetY() const { return mY; }
+    int GetY() const { return mModel->GetY(); }
 
     /**
      * setter of x location
      * 
      * @param x x location
      */
-    void SetX(int x) { mX = x; }
+    void SetX(int x) { mModel->SetX(x); }
 
     /**
      * setter of y location
      * 
      * @param y y location
      */
-    void SetY(int y) { mY = y; }
+    void SetY(int y) { mModel->SetY(y); }
 
     /**
      * accept a visitor
@@ -160,43 +143,40 @@ public:
      * check if the product has passed the beam
      * @return true if the product has passed the beam
      */
-    bool GetPassedBeam() const { return mPassedBeam; }
+    bool GetPassedBeam() const { return mModel->GetPassedBeam(); }
 
     /**
      * set if the product has passed the beam
      * 
      * @param passed true if the product has passed the beam
      */
-    void SetPassedBeam(bool passed) { mPassedBeam = passed; }
+    void SetPassedBeam(bool passed) { mModel->SetPassedBeam(passed); }
 
-    void SetLast(bool isLast) { mLast = isLast; }
+    /**
+     * mark this product as the last one on its conveyor
+     *
+     * @param isLast true if this is the last product
+     */
+    void SetLast(bool isLast) { mModel->SetLast(isLast); }
 
-    void HasPassedBeam();
+    /**
+     * Logic for after the product passes the beam
+     */
+    void HasPassedBeam() { mModel->HasPassedBeam(); }
+
+    /**
+     * get the simulation state of this product
+     *
+     * @return the product model
+     */
+    std::shared_ptr<ProductModel> GetModel() const { return mModel; }
 
 private:
-    int mPlacement = 0; ///< Placement on conveyor
-    Properties mShape; ///< Shape of the product
-    Properties mColor; ///< Color of the product
-    Properties mContent; ///< Content inside the product
-    bool mKick; ///< Should the product be kicked?
-    double mWidth = ProductDefaultSize; ///< Default width in pixels
+    /// Simulation state of the product
+    std::shared_ptr<ProductModel> mModel;
+
     double mContentScale = 0.8; ///< Scale of content relative to the product size
-    int mX; ///< x location
-    int mY; ///< y location
-    double mKickSpeed = 0; ///< Speed of the kick
-    bool mIsOnConveyor = true; ///< Is the product on the conveyor?
-    double mConveyorSpeed = 0; ///< Speed of the conveyor
-    std::unique_ptr<wxImage> mContentImage; ///< Image of the content
-    wxGraphicsBitmap mContentBitmap; ///< Bitmap of the content
-    bool mPassedBeam = false; ///< Has the product passed the beam?
-
-    int mInitialX = 0; ///< Initial x location
-    int mInitialY = 0; ///< Initial y location
-
-
-    Conveyor* mConveyor = nullptr; ///< The conveyor the product is on
-    bool mLast = false; ///< Is the product the last one?
-    double mLastProductDelay = 0; ///< Delay for the last product
+    ResourceCache::Image mContentImage; ///< Image of the content, shared by every product with it
 };
 
 #endif //PRODUCT_H
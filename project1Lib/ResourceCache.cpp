@@ -0,0 +1,154 @@
+/**
+ * @file ResourceCache.cpp
+ * @author Yeji Lee
+ */
+
+#include "pch.h"
+#include "ResourceCache.h"
+
+/**
+ * pixel memory of a decoded image
+ * @param image the image
+ * @return bytes of its colour and alpha data
+ */
+static size_t ImageBytes(const wxImage& image)
+{
+    if (!image.IsOk())
+    {
+        return 0;
+    }
+
+    size_t pixels = size_t(image.GetWidth()) * size_t(image.GetHeight());
+    return pixels * 3 + (image.HasAlpha() ? pixels : 0);
+}
+
+/**
+ * @return the cache shared by the whole program
+ */
+ResourceCache& ResourceCache::Get()
+{
+    static ResourceCache cache;
+    return cache;
+}
+
+/**
+ * get an image, decoding it if this is the first time it is asked for
+ *
+ * Every caller asking for the same file gets the same image, so
+ * holding on to it costs no decoding or pixel memory of its own.
+ *
+ * @param path the image file
+ * @return the image
+ */
+ResourceCache::Image ResourceCache::GetImage(const std::wstring& path)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto found = mImages.find(path);
+    if (found == mImages.end())
+    {
+        found = mImages.emplace(path, std::make_shared<const wxImage>(path, wxBITMAP_TYPE_ANY)).first;
+    }
+    return found->second;
+}
+
+/**
+ * get the size of an image, decoding it if this is the first time it is asked for
+ * @param path the image file
+ * @return the size in pixels
+ */
+wxSize ResourceCache::GetSize(const std::wstring& path)
+{
+    return GetImage(path)->GetSize();
+}
+
+/**
+ * get an image as a bitmap a graphics context can draw
+ *
+ * The bitmap is made the first time a renderer asks for it and drawn
+ * from the cache every frame after that. Bitmaps belong to their
+ * renderer, not to one context, so every context of that renderer
+ * shares them. Cached images are never let go, so the image is a
+ * stable key.
+ *
+ * @param graphics the graphics context to draw it with
+ * @param image an image from GetImage
+ * @return the bitmap
+ */
+wxGraphicsBitmap ResourceCache::GetBitmap(wxGraphicsContext* graphics, const Image& image)
+{
+    auto key = std::make_pair(graphics->GetRenderer(), image.get());
+    auto found = mBitmaps.find(key);
+    if (found == mBitmaps.end())
+    {
+        found = mBitmaps.emplace(key, graphics->CreateBitmapFromImage(*image)).first;
+    }
+    return found->second;
+}
+
+/**
+ * get an image file as a bitmap a graphics context can draw
+ *
+ * @param graphics the graphics context to draw it with
+ * @param path the image file
+ * @return the bitmap
+ */
+wxGraphicsBitmap ResourceCache::GetBitmap(wxGraphicsContext* graphics, const std::wstring& path)
+{
+    return GetBitmap(graphics, GetImage(path));
+}
+
+/**
+ * decode images ahead of time
+ *
+ * Decoding happens outside the lock, so the UI thread is only held up
+ * while a finished image is put into the cache. The worker never
+ * copies the wxImage, whose reference count is not atomic; only the
+ * shared_ptr holding it is shared.
+ *
+ * @param paths the image files
+ */
+void ResourceCache::Prefetch(const std::vector<std::wstring>& paths)
+{
+    for (const auto& path : paths)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mImages.count(path) > 0)
+            {
+                continue;
+            }
+        }
+
+        auto image = std::make_shared<const wxImage>(path, wxBITMAP_TYPE_ANY);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        mImages.emplace(path, std::move(image));
+    }
+}
+
+/**
+ * measure the memory held by images, and what sharing them saves
+ *
+ * An image's users are everything holding it apart from the cache.
+ *
+ * @return the usage
+ */
+ResourceCache::Usage ResourceCache::GetUsage()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    Usage usage;
+    for (const auto& entry : mImages)
+    {
+        size_t bytes = ImageBytes(*entry.second);
+        size_t users = size_t(entry.second.use_count()) - 1;
+        usage.mCachedBytes += bytes;
+        if (users > 0)
+        {
+            usage.mImages++;
+            usage.mUsers += users;
+            usage.mBytes += bytes;
+            usage.mUnsharedBytes += bytes * users;
+        }
+    }
+    return usage;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file ResourceCache.h
+ * @author Yeji Lee
+ *
+ * Images decoded once and shared by everything that draws them.
+ */
+
+#ifndef RESOURCECACHE_H
+#define RESOURCECACHE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * decoded images by file path, for the whole program
+ *
+ * Each image file is decoded the first time it is asked for and
+ * handed out from memory after that, both as an Image and as the
+ * wxGraphicsBitmap drawing needs, so nothing is read from disk or
+ * converted while a frame is drawn. Prefetch decodes images ahead of
+ * time and is safe to call from a worker thread; everything else
+ * belongs to the UI thread.
+ *
+ * Images are immutable flyweights: every item showing the same file
+ * holds the same decoded image, and the reference counts tell
+ * GetUsage how many items share each one.
+ */
+class ResourceCache
+{
+public:
+    /// A decoded image, shared by everything that shows it
+    typedef std::shared_ptr<const wxImage> Image;
+
+    /**
+     * memory held by the images items are using
+     */
+    struct Usage
+    {
+        size_t mImages = 0; ///< images used by at least one item
+        size_t mUsers = 0; ///< items holding one of those images
+        size_t mBytes = 0; ///< pixel memory of those images
+        size_t mUnsharedBytes = 0; ///< pixel memory if every item decoded its own
+        size_t mCachedBytes = 0; ///< pixel memory of every cached image, used or not
+    };
+
+private:
+    std::mutex mMutex; ///< guards mImages against Prefetch
+    std::map<std::wstring, Image> mImages; ///< decoded images by path
+
+    /// Bitmaps by the renderer that made them and image, UI thread only
+    std::map<std::pair<wxGraphicsRenderer*, const wxImage*>, wxGraphicsBitmap> mBitmaps;
+
+    ResourceCache() = default;
+
+public:
+    /// Copy constructor (disabled)
+    ResourceCache(const ResourceCache&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const ResourceCache&) = delete;
+
+    static ResourceCache& Get();
+
+    Image GetImage(const std::wstring& path);
+    wxSize GetSize(const std::wstring& path);
+    wxGraphicsBitmap GetBitmap(wxGraphicsContext* graphics, const Image& image);
+    wxGraphicsBitmap GetBitmap(wxGraphicsContext* graphics, const std::wstring& path);
+    void Prefetch(const std::vector<std::wstring>& paths);
+    Usage GetUsage();
+};
+
+#endif //RESOURCECACHE_H
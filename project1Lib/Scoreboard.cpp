@@ -6,6 +6,7 @@
 #include "pch.h"
 #include "Game.h"
 #include "Scoreboard.h"
+#include "TextCache.h"
 #include <wx/graphics.h>
 #include <wx/pen.h>
 #include <wx/brush.h>
@@ -15,6 +16,12 @@
  */
 const wxSize ScoreboardSize(380, 100); ///< Size of the scoreboard box
 const int SpacingScoresToInstructions = 40; ///< space between scores and instructions
+
+/// Style of the scores
+const TextCache::Style ScoreStyle = {25, true, wxFONTFAMILY_DEFAULT, L"Arial", true, wxColour(24, 69, 59)};
+
+/// Style of the instructions
+const TextCache::Style InstructionStyle = {15, true, wxFONTFAMILY_DEFAULT, L"Arial", true, wxColour(0, 0, 0)};
 const int SpacingInstructionLines = 17; ///< space between instruction lines
 /**
  * @brief Constructor for Scoreboard.
@@ -61,56 +68,54 @@ void Scoreboard::UpdateGameScore()
     mGameScore += mLevelScore;
 }
 /**
- * @brief Draws the scoreboard on the graphics context.
+ * @brief Draws the scores on the graphics context.
  *
  * @param graphics Shared pointer to the wxGraphicsContext where the scoreboard will be drawn.
  */
 void Scoreboard::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+{
+    // Draw the scores at the top
+    int currentLevel = mGame->GetCurrentLevel();
+    TextCache::Get().Draw(graphics.get(), ScoreStyle,
+                          wxString::Format("Level: %d  Game: %d", currentLevel, mGameScore), mX + 10, mY + 10);
+}
+
+/**
+ * @brief Draws the scoreboard box and its instructions, which do not change during a level.
+ *
+ * @param graphics Shared pointer to the wxGraphicsContext where the scoreboard will be drawn.
+ */
+void Scoreboard::DrawStatic(std::shared_ptr<wxGraphicsContext> graphics)
 {
     // Draw the scoreboard box
     graphics->SetBrush(*wxWHITE_BRUSH);
     graphics->SetPen(wxPen(wxColour(0, 0, 0), 2));
     graphics->DrawRectangle(mX, mY, ScoreboardSize.GetWidth(), ScoreboardSize.GetHeight());
 
-    // Set fonts for score and instructions
-    auto scoreFont = graphics->CreateFont(25, L"Arial", wxFONTFLAG_BOLD, wxColour(24, 69, 59));
-    auto instructionFont = graphics->CreateFont(15, L"Arial", wxFONTFLAG_BOLD, *wxBLACK);
-
-    // Draw the scores at the top
-    int currentLevel = mGame->GetCurrentLevel();
-    graphics->SetFont(scoreFont);
-    graphics->DrawText(
-        wxString::Format("Level: %d  Game: %d", currentLevel, mGameScore),
-        mX + 10, mY + 10
-    );
-
-    // Draw the wrapped instructions
-    graphics->SetFont(instructionFont);
-    DrawWrappedText(graphics, wxString(mInstructions), mX + 10, mY + SpacingScoresToInstructions, 360);
+    // Draw the instructions, a line for each <br/>
+    TextCache::Get().Draw(graphics.get(), InstructionStyle, mInstructions, mX + 10, mY + SpacingScoresToInstructions);
 }
+
 /**
- * @brief Draws wrapped text within a specified width on the graphics context.
+ * the area the scores are drawn in, the scoreboard box
  *
- * @param graphics Shared pointer to the wxGraphicsContext used for drawing text.
- * @param text The text to wrap and draw.
- * @param x The starting X-coordinate.
- * @param y The starting Y-coordinate.
- * @param maxWidth The maximum width for the text line before wrapping.
- */
-void Scoreboard::DrawWrappedText(std::shared_ptr<wxGraphicsContext> graphics, const wxString& text,
-                                 int x, int y, int maxWidth)
+ * @return the bounds in virtual pixels
+ */
+DamageRegion::Rect Scoreboard::GetBounds() const
 {
-    wxArrayString lines = wxSplit(text, '\n');
-
-    double width, height;
+    return {double(mX), double(mY), double(mX + ScoreboardSize.GetWidth()), double(mY + ScoreboardSize.GetHeight())};
+}
 
-    for (const auto& line : lines)
-    {
-        graphics->GetTextExtent(line, &width, &height);
-        graphics->DrawText(line, x, y);
-        y += height;
-    }
+/**
+ * the look of the scoreboard, which changes with the score and level
+ *
+ * @return the look
+ */
+size_t Scoreboard::GetLook() const
+{
+    return size_t(mGameScore) * 1000 + size_t(mGame->GetCurrentLevel());
 }
+
 /**
  * @brief Sets the instructions text to be displayed on the scoreboard.
  *
@@ -75,6 +75,17 @@ public:
      */
     void Draw(std::shared_ptr<wxGraphicsContext> graphics);
 
+    /**
+     * @brief Draws the scoreboard box and instructions into the static layer.
+     *
+     * @param graphics Shared pointer to the wxGraphicsContext where the scoreboard is drawn.
+     */
+    void DrawStatic(std::shared_ptr<wxGraphicsContext> graphics) override;
+
+    DamageRegion::Rect GetBounds() const override;
+
+    size_t GetLook() const override;
+
     /**
      * @brief Sets the instructions text to be displayed on the scoreboard.
      *
@@ -110,18 +121,6 @@ public:
      */
     int GetY() const;
 
-private:
-    /**
-     * @brief Helper function to draw wrapped text within a specified width.
-     *
-     * @param graphics Shared pointer to the wxGraphicsContext used for drawing.
-     * @param text The text to wrap and display.
-     * @param x Starting X-coordinate.
-     * @param y Starting Y-coordinate.
-     * @param maxWidth The maximum width for each line before wrapping.
-     */
-    void DrawWrappedText(std::shared_ptr<wxGraphicsContext> graphics, const wxString& text,
-                         int x, int y, int maxWidth);
 };
 
 #endif // SCOREBOARD_H
@@ -6,6 +6,7 @@
 #include "pch.h"
 #include "Sensor.h"
 #include "Game.h"
+#include "ResourceCache.h"
 
 const std::wstring SensorCameraImage = L"images/sensor-camera.png"; ///< Image for the camera
 const std::wstring SensorCableImage = L"images/sensor-cable.png"; ///< Image for the cable
@@ -45,6 +46,17 @@ const wxColor UofMBlue(0, 39, 76);
  * @return the color of the Panel Background
  */
 const wxColour PanelBackgroundColor(128, 128, 128);
+
+/**
+ * image files a sensor loads, so they can be decoded ahead of time
+ *
+ * @return the image files
+ */
+std::vector<std::wstring> Sensor::GetImages()
+{
+    return {SensorCameraImage, SensorCableImage, IzzoImage, SmithImage, FootballImage, BasketballImage};
+}
+
 /**
  * Constructs a Sensor object with specified positions and output pins.
  *
@@ -58,21 +70,21 @@ const wxColour PanelBackgroundColor(128, 128, 128);
 Sensor::Sensor(Game* game, double cameraX, double cameraY, double cableX, double cableY, wxString sensorOutputs)
     : Item(game, L""), mCameraX(cameraX), mCameraY(cameraY), mCableX(cableX), mCableY(cableY)
 {
-    // Load the camera and cable images into bitmaps
-    wxImage cameraImage(SensorCameraImage);
-    wxImage cableImage(SensorCableImage);
-
-    auto graphics = wxGraphicsContext::Create();
-    mCameraBitmap = graphics->CreateBitmapFromImage(cameraImage);
-    mCableBitmap = graphics->CreateBitmapFromImage(cableImage);
-
     mOutputPins = sensorOutputs;
     GetOutputPins(mOutputPins);
 }
 /**
  *  Destructor for Sensor.
  */
-Sensor::~Sensor() {}
+Sensor::~Sensor()
+{
+    auto& pins = GetGame()->GetPins();
+    for (auto handle : {mRedOutput, mGreenOutput, mBlueOutput, mWhiteOutput, mSquareOutput, mCircleOutput,
+                        mDiamondOutput, mIzzoOutput, mSmithOutput, mFootballOutput, mBasketballOutput})
+    {
+        pins.Remove(handle);
+    }
+}
 /**
  *  Sets the position of the camera.
  *
@@ -96,23 +108,27 @@ void Sensor::SetCablePosition(double x, double y)
     mCableY = y;
 }
 /**
- *  Draws the Sensor, including camera and cable images, and the output pins.
+ *  Draws the Sensor, including camera and cable images, and the output pins,
+ *  into the static layer.
  *
  * @param graphics Shared pointer to the wxGraphicsContext used for drawing.
  */
-void Sensor::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void Sensor::DrawStatic(std::shared_ptr<wxGraphicsContext> graphics)
 {
     // Dimensions for the camera and cable
     double cameraWidth = 168;
     double cameraHeight = 168;
     double cableWidth = 300;
     double cableHeight = 164;
+    auto& resources = ResourceCache::Get();
 
     // Draw the camera bitmap at its designated position
-    graphics->DrawBitmap(mCameraBitmap, mCameraX - 118, mCameraY - 70, cameraWidth, cameraHeight);
+    graphics->DrawBitmap(resources.GetBitmap(graphics.get(), SensorCameraImage), mCameraX - 118, mCameraY - 70,
+                         cameraWidth, cameraHeight);
 
     // Draw the cable bitmap at its designated position
-    graphics->DrawBitmap(mCableBitmap, mCableX - 140, mCableY -60, cableWidth, cableHeight);
+    graphics->DrawBitmap(resources.GetBitmap(graphics.get(), SensorCableImage), mCableX - 140, mCableY -60,
+                         cableWidth, cableHeight);
 
     double boxY = mCableY+(cableHeight/2);
     double currentY = boxY;
@@ -191,41 +207,69 @@ void Sensor::GetOutputPins(wxString sensorOutputs)
         sensorOutputs = sensorOutputs.AfterFirst(' ');
     }
 }
+/**
+ *  Gets the output pins the sensor has, with the property each one detects.
+ *
+ * @return pairs of output pin and property
+ */
+std::vector<std::pair<PinOutput*, Product::Properties>> Sensor::GetPropertyPins() const
+{
+    std::vector<std::pair<PinOutput*, Product::Properties>> pins;
+    auto& pool = GetGame()->GetPins();
+    auto add = [&pins, &pool](OutputPinHandle handle, Product::Properties property)
+    {
+        if (auto pin = pool.Get(handle))
+        {
+            pins.emplace_back(pin, property);
+        }
+    };
+
+    add(mRedOutput, Product::Properties::Red);
+    add(mGreenOutput, Product::Properties::Green);
+    add(mBlueOutput, Product::Properties::Blue);
+    add(mWhiteOutput, Product::Properties::White);
+    add(mSquareOutput, Product::Properties::Square);
+    add(mCircleOutput, Product::Properties::Circle);
+    add(mDiamondOutput, Product::Properties::Diamond);
+    add(mIzzoOutput, Product::Properties::Izzo);
+    add(mSmithOutput, Product::Properties::Smith);
+    add(mFootballOutput, Product::Properties::Football);
+    add(mBasketballOutput, Product::Properties::Basketball);
+    return pins;
+}
+
 /**
  *  Draws a single output pin on the sensor.
  *
  * @param graphics Graphics context for rendering.
  * @param color Color of the output pin.
- * @param pin Pointer to the PinOutput to draw.
+ * @param handle Handle of the output pin to draw, unset if the sensor does not have it.
  * @param currentY Current Y-coordinate for pin placement.
  */
-void Sensor::DrawOutputPin(std::shared_ptr<wxGraphicsContext> graphics, const wxColour& color, const std::unique_ptr<PinOutput>& pin, double& currentY)
+void Sensor::DrawOutputPin(std::shared_ptr<wxGraphicsContext> graphics, const wxColour& color, OutputPinHandle handle, double& currentY)
 {
+    auto pin = GetGame()->GetPins().Get(handle);
+
     double cableWidth = 300;
     double boxX = mCableX + (cableWidth / 2) + 10;
-    bool hasSpecialImage = false;
-    wxBitmap specialImage;
+    const std::wstring* specialImage = nullptr;
 
-    // Load specific images for certain output pins
-    if (pin == mIzzoOutput)
+    // Specific images for certain output pins
+    if (handle == mIzzoOutput)
     {
-        specialImage.LoadFile(IzzoImage, wxBITMAP_TYPE_PNG);
-        hasSpecialImage = true;
+        specialImage = &IzzoImage;
     }
-    else if (pin == mSmithOutput)
+    else if (handle == mSmithOutput)
     {
-        specialImage.LoadFile(SmithImage, wxBITMAP_TYPE_PNG);
-        hasSpecialImage = true;
+        specialImage = &SmithImage;
     }
-    else if (pin == mFootballOutput)
+    else if (handle == mFootballOutput)
     {
-        specialImage.LoadFile(FootballImage, wxBITMAP_TYPE_PNG);
-        hasSpecialImage = true;
+        specialImage = &FootballImage;
     }
-    else if (pin == mBasketballOutput)
+    else if (handle == mBasketballOutput)
     {
-        specialImage.LoadFile(BasketballImage, wxBITMAP_TYPE_PNG);
-        hasSpecialImage = true;
+        specialImage = &BasketballImage;
     }
 
     if (pin)
@@ -234,31 +278,31 @@ void Sensor::DrawOutputPin(std::shared_ptr<wxGraphicsContext> graphics, const wx
         graphics->SetPen(*wxBLACK_PEN);
         graphics->DrawRectangle(boxX, currentY, PropertySize.GetWidth(), PropertySize.GetHeight());
 
-        if (hasSpecialImage && specialImage.IsOk())
+        if (specialImage != nullptr && ResourceCache::Get().GetImage(*specialImage)->IsOk())
         {
-            wxGraphicsBitmap graphicsBitmap = graphics->CreateBitmap(specialImage);
+            auto graphicsBitmap = ResourceCache::Get().GetBitmap(graphics.get(), *specialImage);
 
             double imageX = boxX + (PropertySize.GetWidth() / 3);
             double imageY = currentY + (PropertySize.GetHeight() / 8);
 
             graphics->DrawBitmap(graphicsBitmap, imageX, imageY, PropertyShapeSize, PropertyShapeSize);
         }
-        else if (pin == mCircleOutput || pin == mSquareOutput || pin == mDiamondOutput)
+        else if (handle == mCircleOutput || handle == mSquareOutput || handle == mDiamondOutput)
         {
             double shapeX = boxX + PropertySize.GetWidth() / 2;
             double shapeY = currentY + PropertySize.GetHeight() / 2;
             double shapeSize = PropertySize.GetHeight() * 0.8;
             graphics->SetBrush(*wxWHITE_BRUSH);
 
-            if (pin == mCircleOutput)
+            if (handle == mCircleOutput)
             {
                 graphics->DrawEllipse(shapeX - shapeSize / 2, shapeY - shapeSize / 2, PropertyShapeSize, PropertyShapeSize);
             }
-            else if (pin == mSquareOutput)
+            else if (handle == mSquareOutput)
             {
                 graphics->DrawRectangle(shapeX - shapeSize / 2, shapeY - shapeSize / 2, PropertyShapeSize, PropertyShapeSize);
             }
-            else if (pin == mDiamondOutput)
+            else if (handle == mDiamondOutput)
             {
                 wxGraphicsPath path = graphics->CreatePath();
                 path.MoveToPoint(shapeX, shapeY - shapeSize / 2);
@@ -281,16 +325,18 @@ void Sensor::DrawOutputPin(std::shared_ptr<wxGraphicsContext> graphics, const wx
 /**
  *  Adds a output pin at a calculated location on the cable.
  *
- * @param pin Pointer to the unique output pin.
+ * @param handle Set to the handle of the new pin.
  */
-void Sensor::AddOutputPin(std::unique_ptr<PinOutput>& pin)
+void Sensor::AddOutputPin(OutputPinHandle& handle)
 {
     double cableWidth = 300;
     double cableHeight = 164;
     double pinX = mCableX + (cableWidth / 2) + 130;
     double pinY = mCableY + (cableHeight / 2) + 20 + (mSensorCount * 40);
-    pin = std::make_unique<PinOutput>();
-    pin->SetLocation(pinX, pinY);
+    auto& pins = GetGame()->GetPins();
+    pins.Remove(handle);
+    handle = pins.AddOutput();
+    pins.Get(handle)->SetLocation(pinX, pinY);
     mSensorCount++;
 }
 /**
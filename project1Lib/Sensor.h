@@ -12,6 +12,7 @@
 #include <memory>
 #include <vector>
 #include "Product.h"
+#include "PinOutput.h"
 /**
  * @class Sensor
  * @brief Represents a sensor component in the game, displaying outputs and interacting with products.
@@ -33,6 +34,8 @@ public:
      * @param sensorOutputs String specifying the types of output pins.
      */
     Sensor(Game* game, double cameraX, double cameraY, double cableX, double cableY, wxString sensorOutputs);
+
+    static std::vector<std::wstring> GetImages();
     void Accept(ItemVisitor* visitor) override { visitor->VisitSensor(this); }
 
     // Default constructor and copy operations are disabled
@@ -43,10 +46,22 @@ public:
     // Destructor
     virtual ~Sensor();
 
+    /**
+     * Nothing of the sensor changes during play; it is all in the static layer.
+     * @param graphics graphic object
+     */
+    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override {}
+
     // Draw method to render the camera and cable
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    void DrawStatic(std::shared_ptr<wxGraphicsContext> graphics) override;
 
-    void DrawOutputPin(std::shared_ptr<wxGraphicsContext> graphics, const wxColour& color, const std::unique_ptr<PinOutput>& pin, double& currentY);
+    /**
+     * The sensor draws nothing every frame.
+     * @return an empty area
+     */
+    DamageRegion::Rect GetBounds() const override { return {}; }
+
+    void DrawOutputPin(std::shared_ptr<wxGraphicsContext> graphics, const wxColour& color, OutputPinHandle handle, double& currentY);
 
     // Set individual positions for camera and cable
     void SetCameraPosition(double x, double y);
@@ -54,7 +69,9 @@ public:
 
     void GetOutputPins(wxString sensorOutputs);
 
-    void AddOutputPin(std::unique_ptr<PinOutput>& pin);
+    void AddOutputPin(OutputPinHandle& handle);
+
+    std::vector<std::pair<PinOutput*, Product::Properties>> GetPropertyPins() const;
 
     // Check if a product is within range of the sensor
     bool IsProductInRange(const Product* product);
@@ -72,26 +89,22 @@ private:
     double mCameraX, mCameraY;
     double mCableX, mCableY;
 
-    // Bitmaps for camera and cable
-    wxGraphicsBitmap mCameraBitmap;
-    wxGraphicsBitmap mCableBitmap;
-
     // String to store the active pins
     wxString mOutputPins;
 
     int mSensorCount = 0;
-    // Pin outputs for sensor
-    std::unique_ptr<PinOutput> mRedOutput;
-    std::unique_ptr<PinOutput> mGreenOutput;
-    std::unique_ptr<PinOutput> mBlueOutput;
-    std::unique_ptr<PinOutput> mWhiteOutput;
-    std::unique_ptr<PinOutput> mSquareOutput;
-    std::unique_ptr<PinOutput> mCircleOutput;
-    std::unique_ptr<PinOutput> mDiamondOutput;
-    std::unique_ptr<PinOutput> mIzzoOutput;
-    std::unique_ptr<PinOutput> mSmithOutput;
-    std::unique_ptr<PinOutput> mFootballOutput;
-    std::unique_ptr<PinOutput> mBasketballOutput;
+    // Pin outputs for sensor, in the game's PinPool
+    OutputPinHandle mRedOutput;
+    OutputPinHandle mGreenOutput;
+    OutputPinHandle mBlueOutput;
+    OutputPinHandle mWhiteOutput;
+    OutputPinHandle mSquareOutput;
+    OutputPinHandle mCircleOutput;
+    OutputPinHandle mDiamondOutput;
+    OutputPinHandle mIzzoOutput;
+    OutputPinHandle mSmithOutput;
+    OutputPinHandle mFootballOutput;
+    OutputPinHandle mBasketballOutput;
 
 };
 
@@ -0,0 +1,78 @@
+/**
+ * @file SimulationVisitor.h
+ * @author Yeji Lee
+ *
+ *
+ */
+
+#ifndef SIMULATIONVISITOR_H
+#define SIMULATIONVISITOR_H
+
+#include "ItemVisitor.h"
+#include "Simulation.h"
+#include "Product.h"
+#include "Conveyor.h"
+#include "Beam.h"
+#include "Sparty.h"
+
+/**
+ * visitor that registers the simulation state of an item with a Simulation
+ *
+ */
+class SimulationVisitor : public ItemVisitor
+{
+private:
+    Simulation* mSimulation; ///< simulation the models are added to
+
+public:
+    /**
+     * constructor
+     *
+     * @param simulation the simulation to add models to
+     */
+    SimulationVisitor(Simulation* simulation) : mSimulation(simulation)
+    {
+    }
+
+    /**
+     * visit a product
+     *
+     * @param product the product to register
+     */
+    void VisitProduct(Product* product) override
+    {
+        mSimulation->AddProduct(product->GetModel());
+    }
+
+    /**
+     * visit a conveyor
+     *
+     * @param conveyor the conveyor to register
+     */
+    void VisitConveyor(Conveyor* conveyor) override
+    {
+        mSimulation->AddConveyor(conveyor->GetModel());
+    }
+
+    /**
+     * visit a beam
+     *
+     * @param beam the beam to register
+     */
+    void VisitBeam(Beam* beam) override
+    {
+        mSimulation->AddBeam(beam->GetModel());
+    }
+
+    /**
+     * visit a sparty
+     *
+     * @param sparty the sparty to register
+     */
+    void VisitSparty(Sparty* sparty) override
+    {
+        mSimulation->AddSparty(sparty->GetModel());
+    }
+};
+
+#endif //SIMULATIONVISITOR_H
@@ -14,6 +14,8 @@
 #include <cmath>
 
 #include "Game.h"
+#include "ResourceCache.h"
+#include "TextCache.h"
 
 /// Image for the sparty background, what is behind the boot
 const std::wstring SpartyBackImage = L"images/sparty-back.png";
@@ -43,17 +45,53 @@ const int SpartyPinThirdOffset = 20;
 /// for drawing the line towards the input pin
 const int LineThickness = 3;
 
+/// Style of the noise Sparty makes when kicking
+const TextCache::Style NoiseStyle = {14, false, wxFONTFAMILY_DEFAULT, L"", true, wxColour(255, 0, 0)};
+
+/**
+ * image files Sparty loads, so they can be decoded ahead of time
+ *
+ * @return the image files
+ */
+std::vector<std::wstring> Sparty::GetImages()
+{
+    return {SpartyFrontImage, SpartyBackImage, SpartyBootImage};
+}
+
 Sparty::Sparty(Game* game, int x, int y, int height, wxPoint2DDouble pin, double kickDuration, double kickSpeed)
-    : Item(game, SpartyFrontImage), mX(x), mY(y), mHeight(height), mPin(pin),
-      mKickDuration(kickDuration), mKickSpeed(kickSpeed)
+    : Item(game, SpartyFrontImage)
 {
-    // Calculate width to maintain aspect ratio
-    mWidth = round(mHeight * AspectRatio);
+    mModel = std::make_shared<SpartyModel>(x, y, height, pin.m_x, pin.m_y, kickDuration, kickSpeed);
 
-    // Initialize other properties if needed
-    mRotation = 0; // Initial boot rotation state
-    mInputPin = std::make_unique<PinInput>();
-    mInputPin->SetPosition(mPin.m_x, mPin.m_y);
+    mInputPin = game->GetPins().AddInput();
+    GetInputPin()->SetPosition(pin.m_x, pin.m_y);
+}
+
+/**
+ * destructor, returns the input pin to the game
+ */
+Sparty::~Sparty()
+{
+    GetGame()->GetPins().Remove(mInputPin);
+}
+
+/**
+ * the look of Sparty, which changes as the boot kicks and with the noise shown
+ *
+ * @return the look
+ */
+size_t Sparty::GetLook() const
+{
+    return std::hash<double>()(mModel->GetKickProgress()) ^ std::hash<std::string>()(mCurrentNoise);
+}
+
+/**
+ * retrieves the input pin associated with sparty
+ * @return pointer to the input pin
+ */
+PinInput* Sparty::GetInputPin() const
+{
+    return GetGame()->GetPins().Get(mInputPin);
 }
 
 
@@ -70,8 +108,7 @@ Sparty::Sparty(Game* game, int x, int y, int height, wxPoint2DDouble pin, double
 
 void Sparty::Kick()
 {
-    mIsKicking = true;
-    mKickProgress = 0.0; // Reset kick progress if applicable
+    mModel->Kick();
 
     mCurrentNoise = GetGame()->GetTeam().TriggerNoise();
     mNoiseTimer = 0.0;
@@ -94,7 +131,7 @@ void Sparty::Update(double elapsed)
     if (!mCurrentNoise.empty())
     {
         mNoiseTimer += elapsed;
-        if (mNoiseTimer >= mKickDuration)
+        if (mNoiseTimer >= mModel->GetKickDuration())
         {
             mCurrentNoise.clear();
             mNoiseTimer = 0.0;
@@ -108,72 +145,73 @@ void Sparty::Draw(std::shared_ptr<wxGraphicsContext> graphics)
     // Scaling factor for Sparty's size
     double scaleFactor = 0.3;
 
+    int x = mModel->GetX();
+    int y = mModel->GetY();
+    int height = mModel->GetHeight();
+    wxPoint2DDouble pin(mModel->GetPinX(), mModel->GetPinY());
+    double kickProgress = mModel->GetKickProgress();
 
     // Kick parameters
-    double kickOffsetX = 20 * mKickProgress; // Horizontal offset
-    double kickOffsetY = -10 * mKickProgress; // Upward offset
-    double kickRotation = SpartyBootMaxRotation * mKickProgress; // Rotation for kick
-
-    // Initialize bitmaps if they are not yet created
-    if (mBackBitmap.IsNull())
+    double kickOffsetX = 20 * kickProgress; // Horizontal offset
+    double kickOffsetY = -10 * kickProgress; // Upward offset
+    double kickRotation = SpartyBootMaxRotation * kickProgress; // Rotation for kick
+
+    // Bitmaps for the layers, shared with every other Sparty
+    auto& resources = ResourceCache::Get();
+    auto backBitmap = resources.GetBitmap(graphics.get(), SpartyBackImage);
+    auto bootBitmap = resources.GetBitmap(graphics.get(), SpartyBootImage);
+    auto frontBitmap = resources.GetBitmap(graphics.get(), SpartyFrontImage);
+
+    // Store scaled dimensions the first time
+    if (mBackWidth == 0)
     {
-        wxImage backImage(SpartyBackImage);
-        wxImage bootImage(SpartyBootImage);
-        wxImage frontImage(SpartyFrontImage);
-
-        // Create bitmaps from images
-        mBackBitmap = graphics->CreateBitmapFromImage(backImage);
-        mBootBitmap = graphics->CreateBitmapFromImage(bootImage);
-        mFrontBitmap = graphics->CreateBitmapFromImage(frontImage);
-
-        // Store scaled dimensions
-        mBackWidth = backImage.GetWidth() * scaleFactor;
-        mBackHeight = backImage.GetHeight() * scaleFactor;
+        auto backSize = resources.GetSize(SpartyBackImage);
+        mBackWidth = backSize.GetWidth() * scaleFactor;
+        mBackHeight = backSize.GetHeight() * scaleFactor;
     }
 
     // Common center point for all layers (back, boot, front)
-    double centerX = mX - mBackWidth / 2;
-    double centerY = mY - mBackHeight / 2;
+    double centerX = x - mBackWidth / 2;
+    double centerY = y - mBackHeight / 2;
 
     // Draw the back layer
-    graphics->DrawBitmap(mBackBitmap, centerX, centerY, mBackWidth, mBackHeight);
+    graphics->DrawBitmap(backBitmap, centerX, centerY, mBackWidth, mBackHeight);
 
     // Draw the connecting lines
     graphics->SetPen(wxPen(*wxBLACK, LineThickness));
-    graphics->StrokeLine(mX, mY, mX + SpartyPinFirstOffset, mY);
-    graphics->StrokeLine(mX + SpartyPinFirstOffset, mY, mX + SpartyPinFirstOffset, mY - SpartyPinSecondOffset);
-    graphics->StrokeLine(mX + SpartyPinFirstOffset, mY - SpartyPinSecondOffset, mPin.m_x + SpartyPinThirdOffset,
-                         mY - SpartyPinSecondOffset);
-    graphics->StrokeLine(mPin.m_x + SpartyPinThirdOffset, mY - SpartyPinSecondOffset, mPin.m_x + SpartyPinThirdOffset,
-                         mPin.m_y);
-    graphics->StrokeLine(mPin.m_x + SpartyPinThirdOffset, mPin.m_y, mPin.m_x, mPin.m_y);
-    mInputPin->Draw(graphics);
+    graphics->StrokeLine(x, y, x + SpartyPinFirstOffset, y);
+    graphics->StrokeLine(x + SpartyPinFirstOffset, y, x + SpartyPinFirstOffset, y - SpartyPinSecondOffset);
+    graphics->StrokeLine(x + SpartyPinFirstOffset, y - SpartyPinSecondOffset, pin.m_x + SpartyPinThirdOffset,
+                         y - SpartyPinSecondOffset);
+    graphics->StrokeLine(pin.m_x + SpartyPinThirdOffset, y - SpartyPinSecondOffset, pin.m_x + SpartyPinThirdOffset,
+                         pin.m_y);
+    graphics->StrokeLine(pin.m_x + SpartyPinThirdOffset, pin.m_y, pin.m_x, pin.m_y);
+    GetInputPin()->Draw(graphics);
 
     // Draw the boot layer with kicking offsets and rotation
     graphics->PushState();
-    graphics->Translate(mX + kickOffsetX, mY + kickOffsetY); // Apply kick offsets
+    graphics->Translate(x + kickOffsetX, y + kickOffsetY); // Apply kick offsets
     graphics->Rotate(kickRotation); // Rotate boot for kicking animation
-    graphics->DrawBitmap(mBootBitmap, -mBackWidth / 2, -mBackHeight / 2, mBackWidth, mBackHeight);
+    graphics->DrawBitmap(bootBitmap, -mBackWidth / 2, -mBackHeight / 2, mBackWidth, mBackHeight);
     graphics->PopState();
 
     // Draw the front layer (aligned with back and boot)
-    graphics->DrawBitmap(mFrontBitmap, centerX, centerY, mBackWidth, mBackHeight);
+    graphics->DrawBitmap(frontBitmap, centerX, centerY, mBackWidth, mBackHeight);
 
     if (!mCurrentNoise.empty())
     {
-        wxFont noiseFont(14, wxFONTFAMILY_DEFAULT, wxFONTSTYLE_NORMAL, wxFONTWEIGHT_BOLD);
-        graphics->SetFont(noiseFont, *wxRED);
-
-        double textWidth, textHeight;
-        graphics->GetTextExtent(mCurrentNoise, &textWidth, &textHeight, nullptr, nullptr);
+        auto& text = TextCache::Get();
+        const auto& layout = text.GetLayout(graphics.get(), NoiseStyle, mCurrentNoise);
+        double textWidth = layout.mWidth;
+        double textHeight = layout.mHeight;
 
-        double textX = mX - textWidth / 2;
-        double textY = mY - mHeight / 2 - textHeight - 10; // 10 pixels above sparty
+        double textX = x - textWidth / 2;
+        double textY = y - height / 2 - textHeight - 10; // 10 pixels above sparty
 
         graphics->SetBrush(*wxWHITE_BRUSH);
         graphics->SetPen(*wxTRANSPARENT_PEN);
         graphics->DrawRectangle(textX - 5, textY - 5, textWidth + 10, textHeight + 10);
 
-        graphics->DrawText(mCurrentNoise, textX, textY);
+        text.Draw(graphics.get(), NoiseStyle, mCurrentNoise, textX, textY);
     }
 }
@@ -15,6 +15,7 @@
 #include <memory>
 #include "Item.h"
 #include "PinInput.h"
+#include "SpartyModel.h"
 
 /**
  * class sparty
@@ -38,6 +39,8 @@ public:
      */
     Sparty(Game* game, int x, int y, int height, wxPoint2DDouble pin, double kickDuration, double kickSpeed);
 
+    static std::vector<std::wstring> GetImages();
+
     /**
      * accept visitor allowing operation specific to sparty
      * @param visitor pointer to the itemvisitor instance
@@ -49,6 +52,12 @@ public:
      * @param graphics shared pointer to the graphics context used for drawing
      */
     void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    size_t GetLook() const override;
+
+    /**
+     * @return the phase updating the sparty is profiled as
+     */
+    FrameProfiler::Phase GetUpdatePhase() const override { return FrameProfiler::Phase::UpdateSpartys; }
 
     /**
      * triggers the kicking logic without graphicscontext
@@ -71,72 +80,29 @@ public:
      * sets sparty kicking state
      * @param kicking boolean value indicating if sparty is kicking
      */
-    void SetKicking(bool kicking) { mIsKicking = kicking; }
+    void SetKicking(bool kicking) { mModel->SetKicking(kicking); }
 
     /**
      * checks if sparty is currently in the kicking state
      * @return true if sparty is kicking
      */
-    bool IsKicking() const { return mIsKicking; }
+    bool IsKicking() const { return mModel->IsKicking(); }
 
     /**
-     * progress of the kick animation
+     * get the simulation state of this sparty
+     * @return the sparty model
      */
-    double mKickProgress = 0.0;
-    /**
-     * retrieves the input pin associated with sparty
-     * @return pointer to the input pin
-     */
-    PinInput* GetInputPin() const {return mInputPin.get();}
+    std::shared_ptr<SpartyModel> GetModel() const { return mModel; }
 
-private:
- /**
-  * position (coordinate)
-  */
-    int mX;
-    /**
-     * position (coordinate)
-     */
-    int mY;
-    /**
-     * height of sparty
-     */
-    int mHeight;
-    /**
-     * width of sparty
-     */
-    int mWidth;
-    /**
-     * location of input pin
-     */
-    wxPoint2DDouble mPin; // Location of input pin
-    /**
-     * duration of kick animation in seconds
-     */
-    double mKickDuration; // Duration of kick animation in seconds
-    /**
-     * speed of kick in pixels per seconds
-     */
-    double mKickSpeed; // Speed of kick in pixels per second
-    /**
-     * boot rotation state for animation
-     */
-    double mRotation = 0; // Boot rotation state for animation
+    ~Sparty() override;
 
-    // Bitmaps for layered images
-    /**
-     * bitmaps for layered image
-     * background layer
-     */
-    wxGraphicsBitmap mBackBitmap; // Background layer
-    /**
-     * boot layer for kicking
-     */
-    wxGraphicsBitmap mBootBitmap; // Boot layer for kicking
+    PinInput* GetInputPin() const;
+
+private:
     /**
-     * foreground layer
+     * simulation state of sparty
      */
-    wxGraphicsBitmap mFrontBitmap; // Foreground layer
+    std::shared_ptr<SpartyModel> mModel;
 
     // Dimensions of the scaled back image
     /**
@@ -148,16 +114,7 @@ private:
      */
     double mBackHeight = 0.0;
 
-    /**
-     * kicking state
-     */
-    bool mIsKicking = false;
-
     // Constants for Sparty's appearance and kicking motion
-    /**
-     * ratio
-     */
-    static constexpr double AspectRatio = 1.2;
     /**
      * sparty boot percentage
      */
@@ -167,9 +124,9 @@ private:
      */
     static constexpr double SpartyBootMaxRotation = 0.8; // Max rotation for kick
     /**
-     * input pin
+     * input pin, in the game's PinPool
      */
-    std::unique_ptr<PinInput> mInputPin;
+    InputPinHandle mInputPin;
 
     /**
      * team feature
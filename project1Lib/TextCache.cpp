@@ -0,0 +1,119 @@
+/**
+ * @file TextCache.cpp
+ * @author Yeji Lee
+ */
+
+#include "pch.h"
+#include "TextCache.h"
+#include <algorithm>
+
+/**
+ * @return what the style is compared by
+ */
+TextCache::Style::Key TextCache::Style::GetKey() const
+{
+    uint32_t colour = (uint32_t(mColour.Red()) << 24) | (uint32_t(mColour.Green()) << 16) |
+                      (uint32_t(mColour.Blue()) << 8) | uint32_t(mColour.Alpha());
+    return {mSize, mPixels, int(mFamily), mFace, mBold, colour};
+}
+
+/**
+ * @return the cache shared by the whole program
+ */
+TextCache& TextCache::Get()
+{
+    static TextCache cache;
+    return cache;
+}
+
+/**
+ * get the font for a style, creating it the first time it is asked for
+ *
+ * @param graphics the context the font is for
+ * @param style the style
+ * @return the font
+ */
+wxGraphicsFont TextCache::GetFont(wxGraphicsContext* graphics, const Style& style)
+{
+    auto key = std::make_pair(graphics->GetRenderer(), style.GetKey());
+    auto found = mFonts.find(key);
+    if (found == mFonts.end())
+    {
+        wxGraphicsFont font;
+        if (style.mPixels)
+        {
+            font = graphics->CreateFont(style.mSize, style.mFace, style.mBold ? wxFONTFLAG_BOLD : wxFONTFLAG_DEFAULT,
+                                        style.mColour);
+        }
+        else
+        {
+            wxFont description(int(style.mSize), style.mFamily, wxFONTSTYLE_NORMAL,
+                               style.mBold ? wxFONTWEIGHT_BOLD : wxFONTWEIGHT_NORMAL, false, style.mFace);
+            font = graphics->CreateFont(description, style.mColour);
+        }
+        found = mFonts.emplace(key, font).first;
+    }
+    return found->second;
+}
+
+/**
+ * get a text laid out in a style, measuring it the first time it is asked for
+ *
+ * Measuring sets the context's font to the style's.
+ *
+ * @param graphics the context the text is for
+ * @param style the style
+ * @param text the text, with a line for each newline
+ * @return the layout, valid until the next call
+ */
+const TextCache::Layout& TextCache::GetLayout(wxGraphicsContext* graphics, const Style& style, const wxString& text)
+{
+    auto key = std::make_tuple(graphics->GetRenderer(), style.GetKey(), text);
+    auto found = mRuns.find(key);
+    if (found != mRuns.end())
+    {
+        return found->second;
+    }
+
+    if (mRuns.size() >= MaxRuns)
+    {
+        mRuns.clear();
+    }
+
+    graphics->SetFont(GetFont(graphics, style));
+
+    Layout layout;
+    for (const auto& line : wxSplit(text, '\n'))
+    {
+        double width, height;
+        graphics->GetTextExtent(line, &width, &height);
+        layout.mLines.push_back(line);
+        layout.mTops.push_back(layout.mHeight);
+        layout.mWidth = std::max(layout.mWidth, width);
+        layout.mHeight += height;
+    }
+
+    return mRuns.emplace(key, std::move(layout)).first->second;
+}
+
+/**
+ * draw a text in a style, one line under another
+ *
+ * @param graphics the context to draw on
+ * @param style the style
+ * @param text the text, with a line for each newline
+ * @param x left of the text
+ * @param y top of the text
+ * @return the layout of the text as drawn, valid until the next call
+ */
+const TextCache::Layout& TextCache::Draw(wxGraphicsContext* graphics, const Style& style, const wxString& text,
+                                         double x, double y)
+{
+    const auto& layout = GetLayout(graphics, style, text);
+    graphics->SetFont(GetFont(graphics, style));
+    for (size_t i = 0; i < layout.mLines.size(); i++)
+    {
+        graphics->DrawText(layout.mLines[i], x, y + layout.mTops[i]);
+    }
+    return layout;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file TextCache.h
+ * @author Yeji Lee
+ *
+ * Fonts and measured text shared by everything that draws text.
+ */
+
+#ifndef TEXTCACHE_H
+#define TEXTCACHE_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/**
+ * graphics fonts and laid out text, for the whole program
+ *
+ * A font is created once per style and renderer, and a text is split
+ * into lines and measured once per text, style and renderer, so
+ * drawing the same text again costs only the DrawText calls. Extents
+ * are in the context's user space, which the game scales as a whole,
+ * so a layout holds at every window size. A changed text is simply a
+ * new entry; past MaxRuns the layouts are dropped and measured again
+ * as they are needed. UI thread only.
+ */
+class TextCache
+{
+public:
+    /**
+     * the font a text is drawn in
+     */
+    struct Style
+    {
+        double mSize = 10; ///< point size, or pixel height if mPixels
+        bool mPixels = false; ///< mSize is in pixels
+        wxFontFamily mFamily = wxFONTFAMILY_DEFAULT; ///< family, if there is no face
+        std::wstring mFace; ///< face name, empty for the family's default
+        bool mBold = false; ///< bold rather than normal weight
+        wxColour mColour; ///< text colour
+
+        /// What styles are compared by
+        typedef std::tuple<double, bool, int, std::wstring, bool, uint32_t> Key;
+        Key GetKey() const;
+    };
+
+    /**
+     * a text split at its newlines and measured
+     */
+    struct Layout
+    {
+        std::vector<wxString> mLines; ///< the lines
+        std::vector<double> mTops; ///< top of each line, from the top of the first
+        double mWidth = 0; ///< width of the widest line
+        double mHeight = 0; ///< height of all the lines
+    };
+
+    /// Layouts kept before they are all dropped
+    static const size_t MaxRuns = 256;
+
+private:
+    /// Fonts by the renderer that made them and style
+    std::map<std::pair<wxGraphicsRenderer*, Style::Key>, wxGraphicsFont> mFonts;
+
+    /// Layouts by renderer, style and text
+    std::map<std::tuple<wxGraphicsRenderer*, Style::Key, wxString>, Layout> mRuns;
+
+    TextCache() = default;
+
+public:
+    /// Copy constructor (disabled)
+    TextCache(const TextCache&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const TextCache&) = delete;
+
+    static TextCache& Get();
+
+    wxGraphicsFont GetFont(wxGraphicsContext* graphics, const Style& style);
+    const Layout& GetLayout(wxGraphicsContext* graphics, const Style& style, const wxString& text);
+    const Layout& Draw(wxGraphicsContext* graphics, const Style& style, const wxString& text, double x, double y);
+};
+
+#endif //TEXTCACHE_H
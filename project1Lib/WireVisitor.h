@@ -88,48 +88,4 @@ public:
     }
 };
 
-/**
- * drawing visitor
- * 
- */
-class WireDrawingVisitor : public ItemVisitor
-{
-private:
-    /**
-     * graphics context for drawing
-     */
-    wxGraphicsContext* mGraphics;
-    /**
-     * flag to indicate if control points show
-     */
-    bool mShowControlPoints;
-
-public:
-    /**
-     * constructor for wiredrawingvisior
-     * @param graphics graphics pointer to the exgraphicscontext for drawing
-     * @param showControlPoints boolean flag to indicate whether to show
-     */
-    WireDrawingVisitor(wxGraphicsContext* graphics, bool showControlPoints)
-        : mGraphics(graphics), mShowControlPoints(showControlPoints)
-    {
-    }
-
-    /**
-     * visits a gate and draws the wires connecting its output pins
-     * @param gate pointer to the gate being visited
-     */
-    void VisitGate(Gate* gate) override
-    {
-        for (auto& outputPin : gate->GetOutputPins())
-        {
-            for (auto inputPin : outputPin.GetConnectedPins())
-            {
-                Wire wire(&outputPin, inputPin);
-                wire.Draw(mGraphics, mShowControlPoints);
-            }
-        }
-    }
-
-};
 #endif //WIREVISITOR_H
@@ -13,6 +13,11 @@
 #include "Conveyor.h"
 #include "Scoreboard.h"
 #include "Product.h"
+#include "Sparty.h"
+#include "LevelTemplateCache.h"
+#include "LevelFile.h"
+#include "LevelReader.h"
+#include "ResourceCache.h"
 
 using namespace std;
 
@@ -27,248 +32,245 @@ XMLParser::XMLParser(Game* game) : mGame(game)
 }
 
 /**
- * @brief Loads data from an XML file and initializes game items.
+ * @brief The levels parsed so far, shared by every parser.
  *
- * @details Parses the specified XML file to extract game settings, including virtual dimensions and items like sensors, conveyors, products, scoreboards, and beams.
- * Each item is added to the game as it is parsed.
+ * @details The game is replaced each time a level is chosen from the menu, so the cache cannot belong to it.
  *
- * @param filename The file path of the XML file to be parsed.
+ * @return The cache.
  */
-void XMLParser::Load(const wxString& filename)
+LevelTemplateCache& XMLParser::GetCache()
 {
-    int virtualHeight;
-    int virtualWidth;
+    static LevelTemplateCache cache;
+    return cache;
+}
 
-    wxXmlDocument xmlDoc;
-    if (!xmlDoc.Load(filename))
+/**
+ * @brief Loads a level and initializes game items.
+ *
+ * @details Gets the level through LoadSource, which only reads the file if the level is not cached or has been
+ * modified since. The game is cleared and its items, including sensors, conveyors, products, scoreboards, and beams,
+ * are then built from the level.
+ *
+ * @param filename The file path of the XML file to be loaded.
+ */
+void XMLParser::Load(const wxString& filename)
+{
+    auto level = LoadSource(filename);
+    if (!level)
     {
         wxMessageBox("Unable to load Game file");
         return;
     }
+
     mGame->Clear();
+    Instantiate(level->GetData());
+}
+
+/**
+ * @brief Gets a level from the cache, loading it if it is not cached or its file has changed.
+ *
+ * @details A compiled level file beside the XML file, with the same name and LevelFile::Extension, is mapped and
+ * used in place when it is at least as new as the XML. Otherwise the XML is parsed.
+ *
+ * @param filename The file path of the XML file.
+ * @return The level, or nullptr if it could not be loaded.
+ */
+shared_ptr<const LevelSource> XMLParser::LoadSource(const wxString& filename)
+{
+    std::filesystem::path path(filename.ToStdWstring());
+    auto compiled = path;
+    compiled.replace_extension(LevelFile::Extension);
+
+    std::error_code xmlError, compiledError;
+    auto xmlTime = std::filesystem::last_write_time(path, xmlError);
+    auto compiledTime = std::filesystem::last_write_time(compiled, compiledError);
+    if (xmlError && compiledError)
+    {
+        // neither exists, and wxXmlDocument would log an error of its own
+        return nullptr;
+    }
 
-    auto root = xmlDoc.GetRoot();
+    bool useCompiled = !compiledError && (xmlError || compiledTime >= xmlTime);
 
-    auto sizeString = root->GetAttribute("size", "0,0");
-    sizeString.BeforeFirst(',').ToInt(&virtualWidth);
-    sizeString.AfterFirst(',').ToInt(&virtualHeight);
+    auto& cache = GetCache();
+    auto& source = useCompiled ? compiled : path;
+    auto level = cache.Find(source);
+    if (level)
+    {
+        return level;
+    }
 
-    auto child = root->GetChildren();
-    for (; child; child = child->GetNext())
+    if (useCompiled)
     {
-        auto name = child->GetName();
-        if (name == L"items")
+        level = LevelFile::Open(compiled);
+    }
+    if (!level)
+    {
+        level = Parse(filename);
+        if (!level)
         {
-            auto node = child->GetChildren();
-            XmlItems(node);
+            return nullptr;
         }
+        cache.Store(path, level);
+        return level;
     }
-    mGame->SetVirtualWidth(virtualWidth);
-    mGame->SetVirtualHeight(virtualHeight);
+
+    cache.Store(compiled, level);
+    return level;
 }
 
 /**
- * @brief Processes each XML node to create game items based on node attributes.
+ * @brief Parses a level and decodes its images ahead of time, for a worker thread.
  *
- * @details This function handles the creation and configuration of various game items based on the node type. Supported items include sensors, conveyors,
- * products, scoreboards, beams, and Sparty. Each item is configured with its specific properties and added to the game.
+ * @details The level goes into the cache and its images into the ResourceCache, so a later Load of the same
+ * file finds both ready. Nothing here touches a game or shows a message; a missing file is quietly skipped,
+ * since the level after the last one does not exist.
  *
- * @param node Pointer to the XML node containing item data.
+ * @param filename The file path of the XML file to be parsed.
  */
-void XMLParser::XmlItems(wxXmlNode* node)
+void XMLParser::Prefetch(const wxString& filename)
 {
-    for (; node; node = node->GetNext())
+    auto level = LoadSource(filename);
+    if (!level)
     {
-        shared_ptr<Item> item;
-        auto name = node->GetName();
-        if (name == L"sensor")
+        return;
+    }
+
+    auto data = level->GetData();
+    std::vector<std::wstring> images;
+    auto add = [&images](const std::vector<std::wstring>& files)
+    {
+        images.insert(images.end(), files.begin(), files.end());
+    };
+
+    for (uint32_t i = 0; i < data.mItemCount; i++)
+    {
+        switch (data.mItems[i].mKind)
         {
-            int x = 0, y = 0;
-            node->GetAttribute(L"x", "0").ToInt(&x);
-            node->GetAttribute(L"y", "0").ToInt(&y);
+        case ItemTemplate::Kind::Sensor:
+            add(Sensor::GetImages());
+            break;
 
-            wxString sensorOutputs;
+        case ItemTemplate::Kind::Conveyor:
+            add(Conveyor::GetImages());
+            break;
 
-            for (auto child = node->GetChildren(); child; child = child->GetNext())
-            {
-                if (child->GetType() == wxXML_ELEMENT_NODE)
-                {
-                    sensorOutputs += child->GetName() + " ";
-                }
-            }
+        case ItemTemplate::Kind::Beam:
+            add(Beam::GetImages());
+            break;
 
-            item = make_shared<Sensor>(mGame, x, y, x, y, sensorOutputs);
+        case ItemTemplate::Kind::Sparty:
+            add(Sparty::GetImages());
+            break;
+
+        default:
+            break;
         }
-        else if (name == L"conveyor")
-        {
-            int x = 0, y = 0, speed = 0, height = 0;
-            wxString panelStr;
+    }
 
-            node->GetAttribute(L"x", "0").ToInt(&x);
-            node->GetAttribute(L"y", "0").ToInt(&y);
-            node->GetAttribute(L"speed", "0").ToInt(&speed);
-            node->GetAttribute(L"height", "0").ToInt(&height);
-            panelStr = node->GetAttribute(L"panel", "0,0");
+    ResourceCache::Get().Prefetch(images);
+}
 
-            int panelX = 0, panelY = 0;
-            panelStr.BeforeFirst(',').ToInt(&panelX);
-            panelStr.AfterFirst(',').ToInt(&panelY);
+/**
+ * @brief Parses an XML level file into a level description.
+ *
+ * @details The file is streamed through a LevelReader, which adds each item as it is read instead of building the
+ * whole document first, so very large levels do not need their XML tree in memory.
+ *
+ * @param filename The file path of the XML file to be parsed.
+ * @return The parsed level, or nullptr if the file could not be loaded.
+ */
+shared_ptr<const LevelTemplate> XMLParser::Parse(const wxString& filename)
+{
+    return LevelReader::Read(std::filesystem::path(filename.ToStdWstring()));
+}
 
-            wxPoint panelPnt(panelX, panelY);
+/**
+ * @brief Gets the text of an item as a wxString.
+ *
+ * @param level The level the item is in.
+ * @param item The item.
+ * @return Its sensor outputs or instructions.
+ */
+static wxString Text(const LevelData& level, const ItemTemplate& item)
+{
+    auto text = level.GetText(item);
+    return wxString::FromUTF8(text.data(), text.size());
+}
 
-            auto conveyor = make_shared<Conveyor>(mGame, x, y, speed, height, panelPnt);
-            conveyor->XmlLoad(node);
-            mGame->AddItem(conveyor);
+/**
+ * @brief Builds the items of a level and adds them to the game.
+ *
+ * @details No file or XML is touched here, so loading a cached level again only costs creating its items.
+ *
+ * @param level The level, parsed or mapped from a compiled file.
+ */
+void XMLParser::Instantiate(const LevelData& level)
+{
+    for (uint32_t i = 0; i < level.mItemCount; i++)
+    {
+        const auto& description = level.mItems[i];
+        shared_ptr<Item> item;
+        int x = description.mX;
+        int y = description.mY;
+
+        switch (description.mKind)
+        {
+        case ItemTemplate::Kind::Sensor:
+            item = make_shared<Sensor>(mGame, x, y, x, y, Text(level, description));
+            break;
 
-            int lastPlacement = 0;
+        case ItemTemplate::Kind::Conveyor:
+        {
+            wxPoint panelPnt(description.mPanelX, description.mPanelY);
+            auto conveyor = make_shared<Conveyor>(mGame, x, y, description.mSpeed, description.mHeight, panelPnt);
+            conveyor->SetPosition(description.mPositionX, description.mPositionY);
+            mGame->AddItem(conveyor);
 
             shared_ptr<Product> lastProduct = nullptr;
 
-            auto productNode = node->GetChildren();
-            for (; productNode; productNode = productNode->GetNext())
+            auto first = level.mProducts + description.mFirstProduct;
+            for (auto p = first; p != first + description.mProductCount; ++p)
             {
-                if (productNode->GetName() == L"product")
-                {
-                    wxString placementStr = productNode->GetAttribute(L"placement", L"0");
-                    int placement = 0;
-
-                    // check if placement starts with '+'
-                    if (placementStr.StartsWith(L"+"))
-                    {
-                        placementStr = placementStr.Mid(1);
-
-                        int delta = 0;
-                        placementStr.ToInt(&delta);
-
-                        // update placement as relative to the last placement
-                        placement = lastPlacement + delta;
-                    }
-                    else
-                    {
-                        placementStr.ToInt(&placement);
-                    }
-
-                    lastPlacement = placement;
-
-                    // shape
-                    wxString shapeStr = productNode->GetAttribute(L"shape", L"square");
-                    Product::Properties shape;
-                    if (shapeStr == L"square")
-                        shape = Product::Properties::Square;
-                    else if (shapeStr == L"circle")
-                        shape = Product::Properties::Circle;
-                    else if (shapeStr == L"diamond")
-                        shape = Product::Properties::Diamond;
-                    else
-                        shape = Product::Properties::Square; // default if fail
-
-                    // color
-                    wxString colorStr = productNode->GetAttribute(L"color", L"red");
-                    Product::Properties color;
-                    if (colorStr == L"red")
-                        color = Product::Properties::Red;
-                    else if (colorStr == L"green")
-                        color = Product::Properties::Green;
-                    else if (colorStr == L"blue")
-                        color = Product::Properties::Blue;
-                    else
-                        color = Product::Properties::Red; // default if fail
-
-                    // content
-                    wxString contentStr = productNode->GetAttribute(L"content", L"none");
-                    Product::Properties content;
-                    if (contentStr == L"izzo")
-                        content = Product::Properties::Izzo;
-                    else if (contentStr == L"smith")
-                        content = Product::Properties::Smith;
-                    else if (contentStr == L"basketball")
-                        content = Product::Properties::Basketball;
-                    else if (contentStr == L"football")
-                        content = Product::Properties::Football;
-                    else
-                        content = Product::Properties::None; // default if fail
-
-                    // kick attribute
-                    wxString kickStr = productNode->GetAttribute(L"kick", L"no");
-                    bool kick = (kickStr == L"yes");
-
-                    auto product = make_shared<Product>(mGame, placement, shape, color, content, kick);
-                    product->XmlLoad(productNode);
-                    product->SetConveyor(conveyor.get());
-
-                    int productX = conveyor->GetX();
-                    int productY = conveyor->GetY() - placement;
-
-                    product->SetLocation(productX, productY);
-
-                    mGame->AddItem(product);
-                    lastProduct = product;
-                }
+                auto product = make_shared<Product>(mGame, p->mPlacement, p->mShape, p->mColor, p->mContent, p->mKick);
+                product->SetConveyor(conveyor.get());
+
+                int productX = conveyor->GetX();
+                int productY = conveyor->GetY() - p->mPlacement;
+
+                product->SetLocation(productX, productY);
+
+                mGame->AddItem(product);
+                lastProduct = product;
             }
             if (lastProduct)
             {
                 lastProduct->SetLast(true);
             }
+            continue;
         }
-        else if (name == L"scoreboard")
-        {
-            int x = 0, y = 0, goodScore = 0, badScore = 0;
 
-            node->GetAttribute(L"x", "0").ToInt(&x);
-            node->GetAttribute(L"y", "0").ToInt(&y);
-            node->GetAttribute(L"good", "0").ToInt(&goodScore);
-            node->GetAttribute(L"bad", "0").ToInt(&badScore);
+        case ItemTemplate::Kind::Scoreboard:
+            item = make_shared<Scoreboard>(mGame, x, y, description.mGood, description.mBad, Text(level, description));
+            break;
 
-            wxString instructions;
-            for (auto child = node->GetChildren(); child; child = child->GetNext())
-            {
-                if (child->GetType() == wxXML_TEXT_NODE)
-                {
-                    instructions += child->GetContent();
-                }
-                else if (child->GetName() == L"br")
-                {
-                    instructions += wxT("\n");
-                }
-            }
+        case ItemTemplate::Kind::Beam:
+            item = make_shared<Beam>(mGame, x, y, description.mSender);
+            break;
 
-            item = make_shared<Scoreboard>(mGame, x, y, goodScore, badScore, instructions);
-        }
-        else if (name == L"beam")
+        case ItemTemplate::Kind::Sparty:
         {
-            int x = 0, y = 0, sender = 0;
-
-            node->GetAttribute(L"x", "0").ToInt(&x);
-            node->GetAttribute(L"y", "0").ToInt(&y);
-            node->GetAttribute(L"sender", "0").ToInt(&sender);
-
-            item = make_shared<Beam>(mGame, x, y, sender);
+            wxPoint pin(description.mPinX, description.mPinY);
+            item = make_shared<Sparty>(mGame, x, y, description.mHeight, pin, description.mKickDuration,
+                                           description.mKickSpeed);
+            break;
         }
-        else if (name == L"sparty")
-        {
-            int x = 0, y = 0, height = 0;
-            double kickDuration = 0.0, kickSpeed = 0.0;
-            wxString pinStr;
-
-            node->GetAttribute(L"x", "0").ToInt(&x);
-            node->GetAttribute(L"y", "0").ToInt(&y);
-            node->GetAttribute(L"height", "0").ToInt(&height);
-            node->GetAttribute(L"kick-duration", "0.0").ToDouble(&kickDuration);
-            node->GetAttribute(L"kick-speed", "0.0").ToDouble(&kickSpeed);
-            pinStr = node->GetAttribute(L"pin", "0,0");
-
-            int pinX = 0, pinY = 0;
-            pinStr.BeforeFirst(',').ToInt(&pinX);
-            pinStr.AfterFirst(',').ToInt(&pinY);
-            wxPoint pin(pinX, pinY);
-
-            item = make_shared<Sparty>(mGame, x, y, height, pin, kickDuration, kickSpeed);
         }
 
-        if (item != nullptr)
-        {
-            item->XmlLoad(node);
-            mGame->AddItem(item);
-        }
+        item->SetPosition(description.mPositionX, description.mPositionY);
+        mGame->AddItem(item);
     }
+
+    mGame->SetVirtualWidth(level.mWidth);
+    mGame->SetVirtualHeight(level.mHeight);
 }
@@ -9,22 +9,29 @@
 #ifndef XMLPARSER_H
 #define XMLPARSER_H
 
+#include <memory>
+#include "LevelTemplate.h"
+
 class Game;
+class LevelTemplateCache;
 
 /**
  * @class XMLParser
  * @brief A parser that loads game levels and items from an XML file.
  *
- * @details The XMLParser class reads XML files to initialize and load game configurations and level data. This includes
- * reading attributes for items like sensors, conveyors, products, and various in-game elements, then adding them
- * to the associated Game instance.
+ * @details The XMLParser class streams XML files into a LevelTemplate, a plain description of every sensor, conveyor,
+ * product and other item of the level, then builds the items of the associated Game instance from it. A level
+ * compiled to a LevelFile is mapped and used in place of its XML instead. Loaded levels are kept in a cache shared
+ * by every parser, so loading a level again only checks the file's modification time and clones the items from
+ * the template.
  */
 class XMLParser {
 private:
     /// The game the level will be loaded into
     Game* mGame;
 
-    int mProductCounter = 0;
+    static LevelTemplateCache& GetCache();
+    static std::shared_ptr<const LevelSource> LoadSource(const wxString &filename);
 
 public:
     /**
@@ -48,20 +55,22 @@ public:
  *
  * @param filename The path to the XML file to be loaded.
  *
- * @details This method parses the XML file specified by `filename` and loads all game elements and configurations
- * into the Game instance associated with the parser.
+ * @details This method takes the level from the cache, parsing the XML file specified by `filename` only if it is
+ * not cached or has changed, and loads all game elements and configurations into the Game instance associated
+ * with the parser.
  */
     void Load(const wxString &filename);
 
     /**
- * @brief Parses XML nodes to create game items and add them to the game.
- *
- * @param node Pointer to the root XML node that contains game item elements.
+ * @brief Builds the items of a level and adds them to the game.
  *
- * @details The method processes each child node to create and configure game items such as sensors, conveyors,
- * products, and scoreboards, then adds each to the Game instance.
+ * @param level The level, parsed or mapped from a compiled file.
  */
-    void XmlItems(wxXmlNode *node);
+    void Instantiate(const LevelData &level);
+
+    static std::shared_ptr<const LevelTemplate> Parse(const wxString &filename);
+
+    static void Prefetch(const wxString &filename);
 };
 
 
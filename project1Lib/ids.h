@@ -29,6 +29,9 @@ enum IDs
     IDM_NOT_GATE,
     IDM_SRFLIP_GATE,
     IDM_DRFLIP_GATE,
+    IDM_MEMORY_REPORT,
+    IDM_PROFILER,
+    IDM_CHECK_CIRCUIT,
 };
 
 #endif //IDS_H
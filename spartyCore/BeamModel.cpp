@@ -0,0 +1,72 @@
+/**
+ * @file BeamModel.cpp
+ * @author Yeji Lee
+ */
+
+#include "BeamModel.h"
+#include "ProductModel.h"
+#include <algorithm>
+
+/**
+ * constructor
+ *
+ * @param x x location of the beam item
+ * @param y y location of the beam
+ * @param senderOffset offset for the sender
+ */
+BeamModel::BeamModel(int x, int y, int senderOffset)
+    : mX(x + senderOffset), mY(y), mSenderOffset(senderOffset)
+{
+}
+
+/**
+ * set the broken state from the products recorded as intersecting
+ *
+ * @return true if the broken state changed
+ */
+bool BeamModel::UpdateBroken()
+{
+    bool wasBroken = mBroken;
+    mBroken = !mIntersecting.empty();
+    mChanged = wasBroken != mBroken;
+
+    if (!mChanged)
+    {
+        return false;
+    }
+
+    // beam is broken, output is 0; beam is intact, output is 1
+    mOutputState = mBroken ? States::Zero : States::One;
+    return true;
+}
+
+/**
+ * check if the beam is intersecting with a product
+ *
+ * @param product the product to test
+ * @return true if the beam is intersecting with the product
+ */
+bool BeamModel::IsIntersecting(const ProductModel& product) const
+{
+    double productX = product.GetX();
+    double productY = product.GetY();
+    double productSize = product.GetWidth();
+
+    double x1 = mX - mSenderOffset;
+    double y1 = mY;
+    double x2 = mX;
+
+    if (productY - productSize / 2 > y1 + BeamPadding || // product is below beam
+        productY + productSize / 2 < y1 - BeamPadding) // product is above beam
+    {
+        return false;
+    }
+
+    if (productX + productSize / 2 < std::min(x1, x2) ||
+        productX - productSize / 2 > std::max(x1, x2))
+    {
+        return false; // product is to left or right of beam
+    }
+
+    return true; // intersects beam
+}
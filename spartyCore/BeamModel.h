@@ -0,0 +1,111 @@
+/**
+ * @file BeamModel.h
+ * @author Yeji Lee
+ *
+ * Simulation state of a beam that detects products on the conveyor.
+ */
+
+#ifndef BEAMMODEL_H
+#define BEAMMODEL_H
+
+#include <vector>
+#include "States.h"
+
+class ProductModel;
+
+/// Distance above and below the beam line that still breaks the beam
+const int BeamPadding = 5;
+
+/**
+ * wxWidgets-free beam: knows whether a product is breaking it and
+ * what its output pin should read
+ */
+class BeamModel
+{
+private:
+    int mX; ///< x location of the receiver
+    int mY; ///< y location
+    int mSenderOffset; ///< x offset from the receiver to the sender
+    bool mBroken = false; ///< state of beam
+    bool mChanged = false; ///< did the last UpdateBroken change the state
+    States mOutputState = States::Unknown; ///< state driven onto the output pin
+
+    /// products currently crossing the beam, filled by Simulation::UpdateBeams
+    std::vector<ProductModel*> mIntersecting;
+
+public:
+    BeamModel(int x, int y, int senderOffset);
+
+    /// Default constructor (disabled)
+    BeamModel() = delete;
+
+    /// Copy constructor (disabled)
+    BeamModel(const BeamModel&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const BeamModel&) = delete;
+
+    bool IsIntersecting(const ProductModel& product) const;
+    bool UpdateBroken();
+
+    /**
+     * forget the products found crossing the beam last step
+     */
+    void ClearIntersecting() { mIntersecting.clear(); }
+
+    /**
+     * record a product crossing the beam this step
+     * @param product the product
+     */
+    void AddIntersecting(ProductModel* product) { mIntersecting.push_back(product); }
+
+    /**
+     * products crossing the beam as of the last Simulation::UpdateBeams
+     * @return the intersecting products
+     */
+    const std::vector<ProductModel*>& GetIntersecting() const { return mIntersecting; }
+
+    /**
+     * check if the beam is broken
+     * @return true if the beam is broken
+     */
+    bool IsBroken() const { return mBroken; }
+
+    /**
+     * check if the last step broke or restored the beam
+     * @return true if the broken state changed in the last UpdateBroken
+     */
+    bool HasChanged() const { return mChanged; }
+
+    /**
+     * set the beam to broken
+     * @param broken true if broken
+     */
+    void SetBroken(bool broken) { mBroken = broken; }
+
+    /**
+     * state the beam drives onto its output pin
+     * @return One when intact, Zero when broken, Unknown before the first change
+     */
+    States GetOutputState() const { return mOutputState; }
+
+    /**
+     * getter for x location of the receiver
+     * @return x location
+     */
+    int GetX() const { return mX; }
+
+    /**
+     * getter for y location
+     * @return y location
+     */
+    int GetY() const { return mY; }
+
+    /**
+     * getter for the sender offset
+     * @return offset from receiver to sender in pixels
+     */
+    int GetSenderOffset() const { return mSenderOffset; }
+};
+
+#endif //BEAMMODEL_H
@@ -0,0 +1,455 @@
+/**
+ * @file Circuit.cpp
+ * @author Yeji Lee
+ */
+
+#include "Circuit.h"
+#include "GateLogic.h"
+#include "LogicPlanes.h"
+#include <algorithm>
+
+/// Number of values a States can take
+const int StateCount = 3;
+
+/**
+ * truth table of a two input gate, indexed by a * StateCount + b
+ */
+struct TruthTable
+{
+    States mOut[StateCount * StateCount]; ///< output for each pair of inputs
+
+    /**
+     * build the table from a gate function
+     * @param compute the function to tabulate
+     */
+    explicit TruthTable(States (*compute)(States, States))
+    {
+        for (int a = 0; a < StateCount; a++)
+        {
+            for (int b = 0; b < StateCount; b++)
+            {
+                mOut[a * StateCount + b] = compute(States(a), States(b));
+            }
+        }
+    }
+
+    /**
+     * look up an output
+     * @param a first input
+     * @param b second input
+     * @return the output state
+     */
+    States operator()(States a, States b) const
+    {
+        return mOut[int(a) * StateCount + int(b)];
+    }
+};
+
+/// OR over three-valued states
+static const TruthTable OrTable(ComputeOr);
+
+/// AND over three-valued states
+static const TruthTable AndTable(ComputeAnd);
+
+/**
+ * constructor
+ */
+Circuit::Circuit()
+{
+    Clear();
+}
+
+/**
+ * remove all nets and gates, leaving only UnconnectedNet
+ */
+void Circuit::Clear()
+{
+    mNets.assign(1, States::Unknown);
+    mGates.clear();
+    mProgram.clear();
+    mLevelStarts.clear();
+    mReaderStarts.clear();
+    mReaders.clear();
+    mQueued.clear();
+    mQueue = {};
+    mPending.clear();
+    mChanged.clear();
+    mDirty = false;
+}
+
+/**
+ * add a net, starting out Unknown
+ * @return the new net number
+ */
+uint32_t Circuit::AddNet()
+{
+    mNets.push_back(States::Unknown);
+    return uint32_t(mNets.size() - 1);
+}
+
+/**
+ * add a gate to the circuit
+ *
+ * The gate is not evaluated until the next Compile.
+ *
+ * @param op the gate operation
+ * @param a first input net
+ * @param b second input net, UnconnectedNet if the gate has one input
+ * @param out output net
+ */
+void Circuit::AddGate(GateOp op, uint32_t a, uint32_t b, uint32_t out)
+{
+    mGates.push_back({op, a, b, out});
+    mDirty = true;
+}
+
+/**
+ * sort the gates into levels
+ *
+ * A gate's level is one more than the highest level of the gates
+ * driving its inputs; gates driven only by input nets are level 0.
+ * Gates in a feedback loop, such as cross-coupled latches, cannot
+ * be levelized and run last in the order they were added, seeing
+ * the previous step's value around the loop.
+ */
+void Circuit::Compile()
+{
+    const uint32_t None = UINT32_MAX;
+
+    // which gate writes each net
+    std::vector<uint32_t> driver(mNets.size(), None);
+    for (uint32_t i = 0; i < mGates.size(); i++)
+    {
+        driver[mGates[i].mOut] = i;
+    }
+
+    // gates fed by each gate, and how many of a gate's drivers are pending
+    std::vector<std::vector<uint32_t>> fanout(mGates.size());
+    std::vector<int> pending(mGates.size(), 0);
+    for (uint32_t i = 0; i < mGates.size(); i++)
+    {
+        for (auto net : {mGates[i].mA, mGates[i].mB})
+        {
+            auto from = driver[net];
+            if (from != None)
+            {
+                fanout[from].push_back(i);
+                pending[i]++;
+            }
+        }
+    }
+
+    std::vector<int> level(mGates.size(), 0);
+    std::vector<uint32_t> ready;
+    for (uint32_t i = 0; i < mGates.size(); i++)
+    {
+        if (pending[i] == 0)
+        {
+            ready.push_back(i);
+        }
+    }
+
+    int maxLevel = -1;
+    size_t placed = 0;
+    while (placed < ready.size())
+    {
+        auto gate = ready[placed++];
+        maxLevel = std::max(maxLevel, level[gate]);
+        for (auto to : fanout[gate])
+        {
+            level[to] = std::max(level[to], level[gate] + 1);
+            if (--pending[to] == 0)
+            {
+                ready.push_back(to);
+            }
+        }
+    }
+
+    // anything still pending is in a loop
+    for (uint32_t i = 0; i < mGates.size(); i++)
+    {
+        if (pending[i] > 0)
+        {
+            level[i] = maxLevel + 1;
+        }
+    }
+
+    std::vector<uint32_t> order(mGates.size());
+    for (uint32_t i = 0; i < mGates.size(); i++)
+    {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&level](uint32_t a, uint32_t b) { return level[a] < level[b]; });
+
+    mProgram.clear();
+    mLevelStarts.clear();
+    for (auto i : order)
+    {
+        while (int(mLevelStarts.size()) <= level[i])
+        {
+            mLevelStarts.push_back(uint32_t(mProgram.size()));
+        }
+        mProgram.push_back(mGates[i]);
+    }
+    mLevelStarts.push_back(uint32_t(mProgram.size()));
+
+    // readers of each net, counted then filled in program order
+    mReaderStarts.assign(mNets.size() + 1, 0);
+    for (const auto& gate : mProgram)
+    {
+        mReaderStarts[gate.mA + 1]++;
+        if (gate.mB != gate.mA)
+        {
+            mReaderStarts[gate.mB + 1]++;
+        }
+    }
+    for (size_t net = 0; net < mNets.size(); net++)
+    {
+        mReaderStarts[net + 1] += mReaderStarts[net];
+    }
+
+    mReaders.resize(mReaderStarts.back());
+    std::vector<uint32_t> fill(mReaderStarts.begin(), mReaderStarts.end() - 1);
+    for (uint32_t i = 0; i < mProgram.size(); i++)
+    {
+        mReaders[fill[mProgram[i].mA]++] = i;
+        if (mProgram[i].mB != mProgram[i].mA)
+        {
+            mReaders[fill[mProgram[i].mB]++] = i;
+        }
+    }
+
+    // everything runs once after compiling
+    mQueue = {};
+    mChanged.clear();
+    mQueued.assign(mProgram.size(), 1);
+    mPending.resize(mProgram.size());
+    for (uint32_t i = 0; i < mProgram.size(); i++)
+    {
+        mPending[i] = i;
+    }
+
+    mDirty = false;
+}
+
+/**
+ * run every compiled gate once, in level order
+ */
+void Circuit::Evaluate()
+{
+    for (const auto& gate : mProgram)
+    {
+        Step(gate);
+    }
+
+    // nothing drives it, but keep it Unknown even if a caller wrote to it
+    mNets[UnconnectedNet] = States::Unknown;
+}
+
+/**
+ * run only the instructions whose inputs changed
+ *
+ * Instructions run in program order, so within one call an
+ * instruction sees every change made before it, just as in Evaluate.
+ * A change that feeds back to an instruction that already ran, as in
+ * a latch loop, is left for the next call.
+ *
+ * @return number of instructions run
+ */
+size_t Circuit::Propagate()
+{
+    mChanged.clear();
+    for (auto i : mPending)
+    {
+        mQueue.push(i);
+    }
+    mPending.clear();
+
+    size_t count = 0;
+    while (!mQueue.empty())
+    {
+        auto i = mQueue.top();
+        mQueue.pop();
+        mQueued[i] = 0;
+        count++;
+
+        if (Step(mProgram[i]))
+        {
+            mChanged.push_back(mProgram[i].mOut);
+            Schedule(mProgram[i].mOut, i);
+        }
+    }
+
+    mNets[UnconnectedNet] = States::Unknown;
+    return count;
+}
+
+/**
+ * schedule the instructions that read a net
+ *
+ * Readers after the running instruction join this propagation, the
+ * rest wait for the next one.
+ *
+ * @param net the net that changed
+ * @param after program index of the running instruction, UINT32_MAX if none
+ */
+void Circuit::Schedule(uint32_t net, uint32_t after)
+{
+    if (net + 1 >= mReaderStarts.size())
+    {
+        // not compiled yet, Compile schedules everything
+        return;
+    }
+
+    for (auto r = mReaderStarts[net]; r < mReaderStarts[net + 1]; r++)
+    {
+        auto reader = mReaders[r];
+        if (mQueued[reader])
+        {
+            continue;
+        }
+
+        mQueued[reader] = 1;
+        if (after != UINT32_MAX && reader > after)
+        {
+            mQueue.push(reader);
+        }
+        else
+        {
+            mPending.push_back(reader);
+        }
+    }
+}
+
+/**
+ * run one instruction
+ *
+ * @param gate the instruction
+ * @return true if its output net changed
+ */
+bool Circuit::Step(const GateInstruction& gate)
+{
+    States* nets = mNets.data();
+    States a = nets[gate.mA];
+    States b = nets[gate.mB];
+    States& out = nets[gate.mOut];
+    States before = out;
+
+    switch (gate.mOp)
+    {
+    case GateOp::Or:
+        out = OrTable(a, b);
+        break;
+
+    case GateOp::And:
+        out = AndTable(a, b);
+        break;
+
+    case GateOp::Not:
+        out = ComputeNot(a);
+        break;
+
+    case GateOp::SRLatch:
+        if (a == States::One && b == States::One)
+        {
+            out = States::Unknown;
+        }
+        else if (a == States::One)
+        {
+            out = States::One;
+        }
+        else if (b == States::One)
+        {
+            out = States::Zero;
+        }
+        break;
+
+    case GateOp::DLatch:
+        if (b == States::One)
+        {
+            out = a;
+        }
+        break;
+
+    case GateOp::DLatchInverse:
+        // an Unknown D gives One, as the D flip flop always has
+        if (b == States::One)
+        {
+            out = a == States::One ? States::Zero : States::One;
+        }
+        break;
+    }
+
+    return out != before;
+}
+
+/**
+ * run the compiled gates over any number of scenarios, with Unknown
+ *
+ * Like Evaluate, but each net holds one state per scenario in the two
+ * bit planes of LogicPlanes. OR, AND and NOT go through the vectorized
+ * plane kernels. UnconnectedNet is Unknown in every scenario.
+ *
+ * @param planes states of GetNetCount() nets
+ */
+void Circuit::EvaluatePlanes(LogicPlanes& planes) const
+{
+    size_t words = planes.GetWords();
+    std::fill_n(planes.Known(UnconnectedNet), words, 0);
+    std::fill_n(planes.Value(UnconnectedNet), words, 0);
+
+    for (const auto& gate : mProgram)
+    {
+        const uint64_t* knownA = planes.Known(gate.mA);
+        const uint64_t* valueA = planes.Value(gate.mA);
+        const uint64_t* knownB = planes.Known(gate.mB);
+        const uint64_t* valueB = planes.Value(gate.mB);
+        uint64_t* knownOut = planes.Known(gate.mOut);
+        uint64_t* valueOut = planes.Value(gate.mOut);
+
+        switch (gate.mOp)
+        {
+        case GateOp::Or:
+            PlaneOr(knownA, valueA, knownB, valueB, knownOut, valueOut, words);
+            break;
+
+        case GateOp::And:
+            PlaneAnd(knownA, valueA, knownB, valueB, knownOut, valueOut, words);
+            break;
+
+        case GateOp::Not:
+            PlaneNot(knownA, valueA, knownOut, valueOut, words);
+            break;
+
+        case GateOp::SRLatch:
+            for (size_t i = 0; i < words; i++)
+            {
+                uint64_t set = knownA[i] & valueA[i];
+                uint64_t reset = knownB[i] & valueB[i];
+                uint64_t hold = ~(set | reset);
+                knownOut[i] = (set ^ reset) | (hold & knownOut[i]);
+                valueOut[i] = (set & ~reset) | (hold & valueOut[i]);
+            }
+            break;
+
+        case GateOp::DLatch:
+            for (size_t i = 0; i < words; i++)
+            {
+                uint64_t clock = knownB[i] & valueB[i];
+                knownOut[i] = (clock & knownA[i]) | (~clock & knownOut[i]);
+                valueOut[i] = (clock & valueA[i]) | (~clock & valueOut[i]);
+            }
+            break;
+
+        case GateOp::DLatchInverse:
+            for (size_t i = 0; i < words; i++)
+            {
+                uint64_t clock = knownB[i] & valueB[i];
+                knownOut[i] = clock | knownOut[i];
+                valueOut[i] = (clock & ~(knownA[i] & valueA[i])) | (~clock & valueOut[i]);
+            }
+            break;
+        }
+    }
+}
@@ -0,0 +1,155 @@
+/**
+ * @file Circuit.h
+ * @author Yeji Lee
+ *
+ * Gate circuit compiled to a flat, levelized instruction list.
+ */
+
+#ifndef CIRCUIT_H
+#define CIRCUIT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+#include "States.h"
+
+class LogicPlanes;
+
+/**
+ * operation performed by one circuit instruction
+ */
+enum class GateOp : unsigned char
+{
+    Or,      ///< out = a OR b
+    And,     ///< out = a AND b
+    Not,     ///< out = NOT a
+    SRLatch, ///< a is S, b is R, out is Q and keeps its value when neither is set
+    DLatch,  ///< a is D, b is the clock, out is Q and follows D while the clock is One
+    DLatchInverse ///< a is D, b is the clock, out is Q', Zero if D is One and One otherwise while the clock is One
+};
+
+/**
+ * one gate evaluation: read nets a and b, write net out
+ */
+struct GateInstruction
+{
+    GateOp mOp; ///< operation to perform
+    uint32_t mA; ///< first input net
+    uint32_t mB; ///< second input net, UnconnectedNet for Not
+    uint32_t mOut; ///< output net
+};
+
+/**
+ * A gate circuit as a dense array of net states and a list of
+ * instructions over it.
+ *
+ * Nets are added first, then gates as instructions in any order.
+ * Compile sorts the instructions into levels so every gate runs after
+ * the gates that drive it, and Evaluate then runs the whole list once.
+ * Nets that no instruction writes are inputs, set with SetNet before
+ * evaluating.
+ *
+ * Propagate is the event-driven alternative to Evaluate: SetNet only
+ * schedules the instructions reading a net when its state actually
+ * changes, and an instruction whose output changes schedules its own
+ * readers. A step with no input changes runs nothing.
+ */
+class Circuit
+{
+private:
+    /// state of every net, indexed by net number
+    std::vector<States> mNets;
+    /// instructions in the order they were added
+    std::vector<GateInstruction> mGates;
+    /// instructions sorted by level, what Evaluate runs
+    std::vector<GateInstruction> mProgram;
+    /// index in mProgram where each level starts
+    std::vector<uint32_t> mLevelStarts;
+    /// have gates been added since the last Compile
+    bool mDirty = false;
+
+    /// index in mReaders where each net's readers start, one past the last net at the end
+    std::vector<uint32_t> mReaderStarts;
+    /// program indices of the instructions reading each net
+    std::vector<uint32_t> mReaders;
+    /// is each instruction scheduled to run
+    std::vector<char> mQueued;
+    /// instructions to run in this propagation, lowest program index first
+    std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> mQueue;
+    /// instructions scheduled for the next propagation
+    std::vector<uint32_t> mPending;
+    /// nets written with a new state by the last propagation
+    std::vector<uint32_t> mChanged;
+
+    bool Step(const GateInstruction& gate);
+    void Schedule(uint32_t net, uint32_t after);
+
+public:
+    /// Net that nothing drives, read by unconnected inputs. Always Unknown.
+    static const uint32_t UnconnectedNet = 0;
+
+    Circuit();
+
+    void Clear();
+    uint32_t AddNet();
+    void AddGate(GateOp op, uint32_t a, uint32_t b, uint32_t out);
+    void Compile();
+    void Evaluate();
+    size_t Propagate();
+    void EvaluatePlanes(LogicPlanes& planes) const;
+
+    /**
+     * set the state of a net, normally an input net
+     * @param net the net number
+     * @param state the new state
+     */
+    void SetNet(uint32_t net, States state)
+    {
+        if (mNets[net] != state)
+        {
+            mNets[net] = state;
+            Schedule(net, UINT32_MAX);
+        }
+    }
+
+    /**
+     * get the state of a net
+     * @param net the net number
+     * @return the state
+     */
+    States GetNet(uint32_t net) const { return mNets[net]; }
+
+    /**
+     * @return number of nets including UnconnectedNet
+     */
+    size_t GetNetCount() const { return mNets.size(); }
+
+    /**
+     * @return the compiled instructions in evaluation order
+     */
+    const std::vector<GateInstruction>& GetProgram() const { return mProgram; }
+
+    /**
+     * @return number of levels in the compiled program
+     */
+    size_t GetLevelCount() const { return mLevelStarts.empty() ? 0 : mLevelStarts.size() - 1; }
+
+    /**
+     * @return nets whose state the last Propagate changed
+     */
+    const std::vector<uint32_t>& GetChangedNets() const { return mChanged; }
+
+    /**
+     * @return true if the next Propagate has nothing to run
+     */
+    bool IsIdle() const { return mPending.empty(); }
+
+    /**
+     * @return true if gates were added after the last Compile
+     */
+    bool IsDirty() const { return mDirty; }
+};
+
+#endif //CIRCUIT_H
@@ -0,0 +1,40 @@
+/**
+ * @file ConveyorModel.cpp
+ * @author Yeji Lee
+ */
+
+#include "ConveyorModel.h"
+
+/**
+ * constructor
+ *
+ * @param x the x position
+ * @param y the y position
+ * @param speed the speed of the conveyor
+ * @param height the height of the conveyor
+ */
+ConveyorModel::ConveyorModel(int x, int y, double speed, int height)
+    : mX(x), mY(y), mSpeed(speed), mHeight(height)
+{
+}
+
+/**
+ * advance the belt if the conveyor is running, and move its products
+ *
+ * @param elapsed the time elapsed
+ * @return true if the end of level delay of its last product ran out
+ */
+bool ConveyorModel::Update(double elapsed)
+{
+    if (mIsRunning)
+    {
+        mBeltOffset += mSpeed * elapsed;
+
+        if (mBeltOffset >= mHeight)
+        {
+            mBeltOffset -= mHeight;
+        }
+    }
+
+    return mProducts->Update(elapsed, mIsRunning ? mSpeed : 0);
+}
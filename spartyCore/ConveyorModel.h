@@ -0,0 +1,94 @@
+/**
+ * @file ConveyorModel.h
+ * @author Yeji Lee
+ *
+ * Simulation state of a conveyor belt.
+ */
+
+#ifndef CONVEYORMODEL_H
+#define CONVEYORMODEL_H
+
+#include <memory>
+#include "ProductStore.h"
+
+/**
+ * wxWidgets-free state of a conveyor: position, speed and belt motion
+ *
+ * The conveyor also holds the moving state of the products on it, and
+ * moves them all together when it updates.
+ */
+class ConveyorModel
+{
+private:
+    int mX; ///< X position of the conveyor
+    int mY; ///< Y position of the conveyor
+    double mSpeed; ///< Speed of the conveyor in pixels per second
+    int mHeight; ///< Height of the conveyor
+
+    bool mIsRunning = false; ///< If the conveyor is running
+    double mBeltOffset = 0; ///< offset of the belt
+
+    /// products on the conveyor, shared with their ProductModel views
+    std::shared_ptr<ProductStore> mProducts = std::make_shared<ProductStore>();
+
+public:
+    ConveyorModel(int x, int y, double speed, int height);
+
+    /// Default constructor (disabled)
+    ConveyorModel() = delete;
+
+    /// Copy constructor (disabled)
+    ConveyorModel(const ConveyorModel&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const ConveyorModel&) = delete;
+
+    bool Update(double elapsed);
+
+    /**
+     * start the belt moving
+     */
+    void Start() { mIsRunning = true; }
+
+    /**
+     * stop the belt
+     */
+    void Stop() { mIsRunning = false; }
+
+    /**
+     * @return x position of the conveyor
+     */
+    int GetX() const { return mX; }
+
+    /**
+     * @return y position of the conveyor
+     */
+    int GetY() const { return mY; }
+
+    /**
+     * @return speed of the conveyor
+     */
+    double GetSpeed() const { return mSpeed; }
+
+    /**
+     * @return height of the conveyor
+     */
+    int GetHeight() const { return mHeight; }
+
+    /**
+     * @return true if the conveyor is running
+     */
+    bool IsRunning() const { return mIsRunning; }
+
+    /**
+     * @return offset of the belt image
+     */
+    double GetBeltOffset() const { return mBeltOffset; }
+
+    /**
+     * @return the products on the conveyor
+     */
+    const std::shared_ptr<ProductStore>& GetProducts() const { return mProducts; }
+};
+
+#endif //CONVEYORMODEL_H
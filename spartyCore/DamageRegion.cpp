@@ -0,0 +1,102 @@
+/**
+ * @file DamageRegion.cpp
+ * @author Yeji Lee
+ */
+
+#include "DamageRegion.h"
+#include <algorithm>
+
+/// Beyond this in any direction a rectangle is taken to mean everything
+const double EverythingExtent = 1e9;
+
+const DamageRegion::Rect DamageRegion::Everything = {-EverythingExtent, -EverythingExtent,
+                                                     EverythingExtent, EverythingExtent};
+
+/**
+ * the smallest rectangle holding two others
+ * @param other the other rectangle
+ * @return the union
+ */
+DamageRegion::Rect DamageRegion::Rect::Union(const Rect& other) const
+{
+    if (IsEmpty())
+    {
+        return other;
+    }
+    if (other.IsEmpty())
+    {
+        return *this;
+    }
+    return {std::min(mLeft, other.mLeft), std::min(mTop, other.mTop),
+            std::max(mRight, other.mRight), std::max(mBottom, other.mBottom)};
+}
+
+/**
+ * @return true if the rectangle reaches as far as Everything does
+ */
+bool DamageRegion::Rect::IsEverything() const
+{
+    return mLeft <= -EverythingExtent || mTop <= -EverythingExtent ||
+           mRight >= EverythingExtent || mBottom >= EverythingExtent;
+}
+
+/**
+ * @param other the other rectangle
+ * @return true if the rectangles are the same
+ */
+bool DamageRegion::Rect::operator==(const Rect& other) const
+{
+    return mLeft == other.mLeft && mTop == other.mTop && mRight == other.mRight && mBottom == other.mBottom;
+}
+
+/**
+ * add a damaged area
+ *
+ * It is merged with any areas it touches, and those merged with any
+ * they now touch, so the areas kept never overlap.
+ *
+ * @param rect the area, in virtual pixels
+ */
+void DamageRegion::Add(const Rect& rect)
+{
+    if (mAll || rect.IsEmpty())
+    {
+        return;
+    }
+
+    if (rect.IsEverything())
+    {
+        AddAll();
+        return;
+    }
+
+    Rect merged = rect;
+    bool merging = true;
+    while (merging)
+    {
+        merging = false;
+        for (size_t i = 0; i < mRects.size(); i++)
+        {
+            if (mRects[i].Touches(merged))
+            {
+                merged = merged.Union(mRects[i]);
+                mRects[i] = mRects.back();
+                mRects.pop_back();
+                merging = true;
+                break;
+            }
+        }
+    }
+
+    if (mRects.size() < MaxRects)
+    {
+        mRects.push_back(merged);
+        return;
+    }
+
+    for (const auto& other : mRects)
+    {
+        merged = merged.Union(other);
+    }
+    mRects.assign(1, merged);
+}
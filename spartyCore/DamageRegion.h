@@ -0,0 +1,101 @@
+/**
+ * @file DamageRegion.h
+ * @author Yeji Lee
+ *
+ * The parts of the game that changed since they were last drawn.
+ */
+
+#ifndef DAMAGEREGION_H
+#define DAMAGEREGION_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * a set of rectangles in virtual pixels that need to be drawn again
+ *
+ * Rectangles that touch are merged as they are added, and past
+ * MaxRects the whole set collapses to its bounding box, so the window
+ * is asked to repaint a handful of areas at most. Adding Everything
+ * marks the whole game as damaged.
+ */
+class DamageRegion
+{
+public:
+    /**
+     * an axis aligned rectangle, empty when right <= left or bottom <= top
+     */
+    struct Rect
+    {
+        double mLeft = 0; ///< left edge
+        double mTop = 0; ///< top edge
+        double mRight = 0; ///< right edge
+        double mBottom = 0; ///< bottom edge
+
+        /**
+         * @return true if the rectangle has no area
+         */
+        bool IsEmpty() const { return mRight <= mLeft || mBottom <= mTop; }
+
+        /**
+         * do two rectangles overlap or touch
+         * @param other the other rectangle
+         * @return true if they do
+         */
+        bool Touches(const Rect& other) const
+        {
+            return mLeft <= other.mRight && other.mLeft <= mRight && mTop <= other.mBottom && other.mTop <= mBottom;
+        }
+
+        Rect Union(const Rect& other) const;
+        bool IsEverything() const;
+
+        bool operator==(const Rect& other) const;
+
+        /**
+         * @param other the other rectangle
+         * @return true if the rectangles differ
+         */
+        bool operator!=(const Rect& other) const { return !(*this == other); }
+    };
+
+    /// Rectangles kept before they collapse to their bounding box
+    static const size_t MaxRects = 8;
+
+    /// A rectangle covering the whole game, for things with no known bounds
+    static const Rect Everything;
+
+private:
+    std::vector<Rect> mRects; ///< damaged areas, none touching another
+    bool mAll = false; ///< everything is damaged
+
+public:
+    void Add(const Rect& rect);
+
+    /**
+     * mark the whole game as damaged
+     */
+    void AddAll() { mAll = true; mRects.clear(); }
+
+    /**
+     * forget all damage, after it has been drawn
+     */
+    void Clear() { mAll = false; mRects.clear(); }
+
+    /**
+     * @return true if the whole game needs drawing
+     */
+    bool IsAll() const { return mAll; }
+
+    /**
+     * @return true if nothing needs drawing
+     */
+    bool IsEmpty() const { return !mAll && mRects.empty(); }
+
+    /**
+     * @return the damaged areas, unless IsAll
+     */
+    const std::vector<Rect>& GetRects() const { return mRects; }
+};
+
+#endif //DAMAGEREGION_H
@@ -0,0 +1,45 @@
+/**
+ * @file FixedTimestep.cpp
+ * @author Yeji Lee
+ */
+
+#include "FixedTimestep.h"
+
+/**
+ * add a frame's worth of time and find out how many ticks to run
+ *
+ * @param elapsed wall clock time since the last frame in seconds
+ * @return number of TickDuration steps the caller should run now
+ */
+int FixedTimestep::Advance(double elapsed)
+{
+    if (elapsed > 0)
+    {
+        mAccumulator += elapsed;
+    }
+
+    int ticks = 0;
+    while (mAccumulator >= TickDuration && ticks < MaxTicksPerFrame)
+    {
+        mAccumulator -= TickDuration;
+        ticks++;
+    }
+
+    if (ticks == MaxTicksPerFrame && mAccumulator >= TickDuration)
+    {
+        // too far behind, drop the backlog rather than spiral
+        mAccumulator = 0;
+    }
+
+    mTicks += ticks;
+    return ticks;
+}
+
+/**
+ * drop any partial tick and restart the tick count
+ */
+void FixedTimestep::Reset()
+{
+    mAccumulator = 0;
+    mTicks = 0;
+}
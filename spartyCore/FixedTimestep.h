@@ -0,0 +1,50 @@
+/**
+ * @file FixedTimestep.h
+ * @author Yeji Lee
+ *
+ * Turns variable frame times into a whole number of fixed logic ticks.
+ */
+
+#ifndef FIXEDTIMESTEP_H
+#define FIXEDTIMESTEP_H
+
+/// Logic ticks per second
+const int TicksPerSecond = 240;
+
+/// Most ticks run for one frame, so a long stall does not freeze the game catching up
+const int MaxTicksPerFrame = 60;
+
+/**
+ * accumulator for a fixed-timestep update loop
+ *
+ * Frame time is added to the accumulator and consumed in whole ticks of
+ * TickDuration. The simulation only ever sees TickDuration, so the same
+ * number of ticks always gives the same result however the frames fell.
+ */
+class FixedTimestep
+{
+private:
+    double mAccumulator = 0; ///< frame time not yet consumed by a tick
+    long long mTicks = 0; ///< ticks run since the last reset
+
+public:
+    /// Duration of one tick in seconds
+    static constexpr double TickDuration = 1.0 / TicksPerSecond;
+
+    int Advance(double elapsed);
+    void Reset();
+
+    /**
+     * how far the accumulator is into the next tick, for interpolating drawing
+     * @return fraction of a tick from 0 to 1
+     */
+    double GetAlpha() const { return mAccumulator / TickDuration; }
+
+    /**
+     * total ticks since the last reset
+     * @return number of ticks
+     */
+    long long GetTicks() const { return mTicks; }
+};
+
+#endif //FIXEDTIMESTEP_H
@@ -0,0 +1,121 @@
+/**
+ * @file FrameProfiler.cpp
+ * @author Yeji Lee
+ */
+
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <vector>
+
+/**
+ * @return the profiler of the game's frames
+ */
+FrameProfiler& FrameProfiler::Get()
+{
+    static FrameProfiler profiler;
+    return profiler;
+}
+
+/**
+ * @param phase a phase
+ * @return its name, for showing the timings
+ */
+const char* FrameProfiler::GetName(Phase phase)
+{
+    static const char* names[PhaseCount] = {"interval", "timer",  "update", "  conveyors", "  products",
+                                            "  beams", "  sparty", "  gates", "  other",    "  circuit",
+                                            "paint",    "  static", "  items", "  wires"};
+    return names[size_t(phase)];
+}
+
+/**
+ * turn timing on or off, starting again from no frames when it is turned on
+ * @param enabled true to time the phases
+ */
+void FrameProfiler::SetEnabled(bool enabled)
+{
+    if (enabled && !mEnabled)
+    {
+        Clear();
+    }
+    mEnabled = enabled;
+}
+
+/**
+ * end the frame being timed, keeping its sums
+ */
+void FrameProfiler::EndFrame()
+{
+    if (!mEnabled)
+    {
+        return;
+    }
+
+    auto now = Clock::now();
+    if (mTimingInterval)
+    {
+        Add(Phase::Interval, std::chrono::duration<double>(now - mLastFrameEnd).count());
+    }
+    mLastFrameEnd = now;
+    mTimingInterval = true;
+
+    for (size_t phase = 0; phase < PhaseCount; phase++)
+    {
+        mFrames[phase][mNext] = float(mCurrent[phase]);
+    }
+    mCurrent.fill(0);
+    mNext = (mNext + 1) % Frames;
+    mCount = std::min(mCount + 1, Frames);
+}
+
+/**
+ * forget every frame kept
+ */
+void FrameProfiler::Clear()
+{
+    mCurrent.fill(0);
+    mNext = 0;
+    mCount = 0;
+    mTimingInterval = false;
+}
+
+/**
+ * a percentile of the time a phase took per frame
+ *
+ * @param phase the phase
+ * @param percentile from 0 to 100
+ * @return the time in seconds, 0 if no frames are kept
+ */
+double FrameProfiler::GetPercentile(Phase phase, double percentile) const
+{
+    if (mCount == 0)
+    {
+        return 0;
+    }
+
+    const auto& frames = mFrames[size_t(phase)];
+    std::vector<float> times(frames.begin(), frames.begin() + mCount);
+    size_t rank = std::min(size_t(percentile / 100 * mCount), mCount - 1);
+    std::nth_element(times.begin(), times.begin() + rank, times.end());
+    return times[rank];
+}
+
+/**
+ * @param phase the phase
+ * @return the mean time a phase took per frame, in seconds
+ */
+double FrameProfiler::GetMean(Phase phase) const
+{
+    if (mCount == 0)
+    {
+        return 0;
+    }
+
+    const auto& frames = mFrames[size_t(phase)];
+    double total = 0;
+    for (size_t i = 0; i < mCount; i++)
+    {
+        total += frames[i];
+    }
+    return total / mCount;
+}
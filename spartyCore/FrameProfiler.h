@@ -0,0 +1,145 @@
+/**
+ * @file FrameProfiler.h
+ * @author Yeji Lee
+ *
+ * Where the time of each frame goes, kept for the last few seconds.
+ */
+
+#ifndef FRAMEPROFILER_H
+#define FRAMEPROFILER_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+/**
+ * timings of the phases of the last Frames frames
+ *
+ * ScopedTimer adds the time spent in a scope to the frame being
+ * timed; a phase timed several times in a frame, such as updating
+ * each product, is summed. EndFrame stores the sums in a ring buffer
+ * that the percentiles are taken over.
+ *
+ * While disabled a ScopedTimer costs one test of a flag and never
+ * reads the clock.
+ */
+class FrameProfiler
+{
+public:
+    /// Clock the phases are timed with
+    typedef std::chrono::steady_clock Clock;
+
+    /// The timed phases of a frame
+    enum class Phase
+    {
+        Interval, ///< from the end of one frame to the end of the next
+        Timer, ///< the animation timer, updating the game
+        Update, ///< all of Game::Update
+        UpdateConveyors, ///< updating conveyors
+        UpdateProducts, ///< updating products
+        UpdateBeams, ///< updating beams
+        UpdateSpartys, ///< updating Sparty
+        UpdateGates, ///< updating gates
+        UpdateOther, ///< updating any other item
+        Circuit, ///< evaluating the gate circuit
+        Paint, ///< the paint event, drawing the game and notices
+        DrawStatic, ///< drawing and copying the static layer
+        DrawItems, ///< drawing the items
+        DrawWires, ///< drawing the wires
+        Count ///< number of phases
+    };
+
+    /// Number of phases
+    static constexpr size_t PhaseCount = size_t(Phase::Count);
+
+    /// Frames kept
+    static constexpr size_t Frames = 256;
+
+private:
+    bool mEnabled = false; ///< timing is on
+
+    /// sums of the frame being timed, in seconds
+    std::array<double, PhaseCount> mCurrent = {};
+
+    /// sums of the kept frames, in seconds, by phase then frame
+    std::array<std::array<float, Frames>, PhaseCount> mFrames = {};
+
+    size_t mNext = 0; ///< where the next frame goes in mFrames
+    size_t mCount = 0; ///< frames kept, up to Frames
+    Clock::time_point mLastFrameEnd; ///< when EndFrame was last called
+    bool mTimingInterval = false; ///< mLastFrameEnd is set
+
+public:
+    static FrameProfiler& Get();
+    static const char* GetName(Phase phase);
+
+    void SetEnabled(bool enabled);
+
+    /**
+     * @return true if phases are being timed
+     */
+    bool IsEnabled() const { return mEnabled; }
+
+    /**
+     * add time spent in a phase to the frame being timed
+     * @param phase the phase
+     * @param seconds time spent
+     */
+    void Add(Phase phase, double seconds) { mCurrent[size_t(phase)] += seconds; }
+
+    void EndFrame();
+    void Clear();
+
+    /**
+     * @return frames kept
+     */
+    size_t GetFrameCount() const { return mCount; }
+
+    double GetPercentile(Phase phase, double percentile) const;
+    double GetMean(Phase phase) const;
+};
+
+/**
+ * times a scope as a phase of the frame being profiled
+ */
+class ScopedTimer
+{
+private:
+    FrameProfiler* mProfiler; ///< the profiler, nullptr if it is disabled
+    FrameProfiler::Phase mPhase; ///< the phase being timed
+    FrameProfiler::Clock::time_point mStart; ///< when the scope was entered
+
+public:
+    /**
+     * constructor, starting the timing if the profiler is enabled
+     * @param profiler the profiler
+     * @param phase the phase the scope is part of
+     */
+    ScopedTimer(FrameProfiler& profiler, FrameProfiler::Phase phase)
+        : mProfiler(profiler.IsEnabled() ? &profiler : nullptr), mPhase(phase)
+    {
+        if (mProfiler != nullptr)
+        {
+            mStart = FrameProfiler::Clock::now();
+        }
+    }
+
+    /**
+     * destructor, adding the time spent to the phase
+     */
+    ~ScopedTimer()
+    {
+        if (mProfiler != nullptr)
+        {
+            mProfiler->Add(mPhase, std::chrono::duration<double>(FrameProfiler::Clock::now() - mStart).count());
+        }
+    }
+
+    /// Copy constructor (disabled)
+    ScopedTimer(const ScopedTimer&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const ScopedTimer&) = delete;
+};
+
+#endif //FRAMEPROFILER_H
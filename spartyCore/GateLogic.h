@@ -0,0 +1,58 @@
+/**
+ * @file GateLogic.h
+ * @author Yeji Lee
+ *
+ * Three-valued truth functions for the logic gates.
+ * Any Unknown input makes the output Unknown.
+ */
+
+#ifndef GATELOGIC_H
+#define GATELOGIC_H
+
+#include "States.h"
+
+/**
+ * OR of two states
+ * @param a first input
+ * @param b second input
+ * @return the output state
+ */
+inline States ComputeOr(States a, States b)
+{
+    if (a == States::Unknown || b == States::Unknown)
+    {
+        return States::Unknown;
+    }
+    return (a == States::One || b == States::One) ? States::One : States::Zero;
+}
+
+/**
+ * AND of two states
+ * @param a first input
+ * @param b second input
+ * @return the output state
+ */
+inline States ComputeAnd(States a, States b)
+{
+    if (a == States::Unknown || b == States::Unknown)
+    {
+        return States::Unknown;
+    }
+    return (a == States::One && b == States::One) ? States::One : States::Zero;
+}
+
+/**
+ * NOT of a state
+ * @param a the input
+ * @return the output state
+ */
+inline States ComputeNot(States a)
+{
+    if (a == States::Unknown)
+    {
+        return States::Unknown;
+    }
+    return (a == States::One) ? States::Zero : States::One;
+}
+
+#endif //GATELOGIC_H
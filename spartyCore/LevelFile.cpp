@@ -0,0 +1,269 @@
+/**
+ * @file LevelFile.cpp
+ * @author Yeji Lee
+ */
+
+#include "LevelFile.h"
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * round an offset up to the alignment of the arrays
+ * @param offset the offset
+ * @return the aligned offset
+ */
+static uint64_t Align(uint64_t offset)
+{
+    return (offset + LevelFile::Alignment - 1) / LevelFile::Alignment * LevelFile::Alignment;
+}
+
+/**
+ * unmap the file
+ */
+LevelFile::~LevelFile()
+{
+#ifdef _WIN32
+    if (mBegin != nullptr)
+    {
+        UnmapViewOfFile(mBegin);
+    }
+    if (mMapping != nullptr)
+    {
+        CloseHandle(mMapping);
+    }
+#else
+    if (mBegin != nullptr)
+    {
+        munmap(const_cast<char*>(mBegin), mSize);
+    }
+#endif
+}
+
+/**
+ * map a compiled level
+ *
+ * @param path the level file
+ * @return the level, nullptr if the file cannot be mapped or is not a
+ * valid level for this build
+ */
+std::shared_ptr<const LevelFile> LevelFile::Open(const std::filesystem::path& path)
+{
+    std::shared_ptr<LevelFile> file(new LevelFile());
+
+#ifdef _WIN32
+    HANDLE handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size) || size.QuadPart < LONGLONG(sizeof(LevelFileHeader)))
+    {
+        CloseHandle(handle);
+        return nullptr;
+    }
+
+    file->mMapping = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(handle);
+    if (file->mMapping == nullptr)
+    {
+        return nullptr;
+    }
+
+    file->mSize = size_t(size.QuadPart);
+    file->mBegin = static_cast<const char*>(MapViewOfFile(file->mMapping, FILE_MAP_READ, 0, 0, 0));
+    if (file->mBegin == nullptr)
+    {
+        return nullptr;
+    }
+#else
+    int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || status.st_size < off_t(sizeof(LevelFileHeader)))
+    {
+        close(descriptor);
+        return nullptr;
+    }
+
+    file->mSize = size_t(status.st_size);
+    void* begin = mmap(nullptr, file->mSize, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if (begin == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    file->mBegin = static_cast<const char*>(begin);
+#endif
+
+    if (!file->Check())
+    {
+        return nullptr;
+    }
+
+    auto header = reinterpret_cast<const LevelFileHeader*>(file->mBegin);
+    file->mData.mWidth = header->mWidth;
+    file->mData.mHeight = header->mHeight;
+    file->mData.mItems = reinterpret_cast<const ItemTemplate*>(file->mBegin + header->mItemOffset);
+    file->mData.mItemCount = header->mItemCount;
+    file->mData.mProducts = reinterpret_cast<const ProductTemplate*>(file->mBegin + header->mProductOffset);
+    file->mData.mProductCount = header->mProductCount;
+    file->mData.mText = file->mBegin + header->mTextOffset;
+    file->mData.mTextLength = header->mTextLength;
+    return file;
+}
+
+/**
+ * check the mapped file is a level this build can use in place
+ *
+ * @return true if the header matches, every array, product run and
+ * text lies inside the file, and every product's properties are ones
+ * a ProductModel can hold
+ */
+bool LevelFile::Check() const
+{
+    auto header = reinterpret_cast<const LevelFileHeader*>(mBegin);
+    if (std::memcmp(header->mMagic, Magic, sizeof(Magic)) != 0 || header->mVersion != Version ||
+        header->mItemSize != sizeof(ItemTemplate) || header->mProductSize != sizeof(ProductTemplate))
+    {
+        return false;
+    }
+
+    auto inside = [this](uint64_t offset, uint64_t bytes)
+    {
+        return offset % Alignment == 0 && offset + bytes <= mSize;
+    };
+    if (!inside(header->mItemOffset, uint64_t(header->mItemCount) * sizeof(ItemTemplate)) ||
+        !inside(header->mProductOffset, uint64_t(header->mProductCount) * sizeof(ProductTemplate)) ||
+        !inside(header->mTextOffset, header->mTextLength))
+    {
+        return false;
+    }
+
+    auto items = reinterpret_cast<const ItemTemplate*>(mBegin + header->mItemOffset);
+    for (uint32_t i = 0; i < header->mItemCount; i++)
+    {
+        const auto& item = items[i];
+        if (uint64_t(item.mFirstProduct) + item.mProductCount > header->mProductCount ||
+            uint64_t(item.mTextOffset) + item.mTextLength > header->mTextLength ||
+            uint32_t(item.mKind) > uint32_t(ItemTemplate::Kind::Sparty))
+        {
+            return false;
+        }
+    }
+
+    // properties are packed four bits each, and a bool must hold 0 or 1
+    typedef ProductModel::Properties Properties;
+    auto between = [](Properties value, Properties first, Properties last)
+    {
+        return int(value) >= int(first) && int(value) <= int(last);
+    };
+    auto products = reinterpret_cast<const ProductTemplate*>(mBegin + header->mProductOffset);
+    for (uint32_t i = 0; i < header->mProductCount; i++)
+    {
+        const auto& product = products[i];
+        uint8_t kick;
+        std::memcpy(&kick, &product.mKick, sizeof(kick));
+        if (!between(product.mShape, Properties::Square, Properties::Diamond) ||
+            !between(product.mColor, Properties::Red, Properties::White) ||
+            !(product.mContent == Properties::None ||
+              between(product.mContent, Properties::Izzo, Properties::Basketball)) ||
+            kick > 1)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * compile a level to a file
+ *
+ * The file is written beside the target and renamed over it, so a
+ * game that has the old file mapped keeps reading the old contents.
+ *
+ * @param path the level file to write
+ * @param level the level
+ * @return true if the file was written
+ */
+bool LevelFile::Write(const std::filesystem::path& path, const LevelData& level)
+{
+    LevelFileHeader header = {};
+    std::memcpy(header.mMagic, Magic, sizeof(Magic));
+    header.mVersion = Version;
+    header.mItemSize = sizeof(ItemTemplate);
+    header.mProductSize = sizeof(ProductTemplate);
+    header.mWidth = level.mWidth;
+    header.mHeight = level.mHeight;
+
+    uint64_t offset = Align(sizeof(LevelFileHeader));
+    header.mItemCount = level.mItemCount;
+    header.mItemOffset = uint32_t(offset);
+    offset = Align(offset + uint64_t(level.mItemCount) * sizeof(ItemTemplate));
+    header.mProductCount = level.mProductCount;
+    header.mProductOffset = uint32_t(offset);
+    offset = Align(offset + uint64_t(level.mProductCount) * sizeof(ProductTemplate));
+    header.mTextLength = level.mTextLength;
+    header.mTextOffset = uint32_t(offset);
+    if (offset + level.mTextLength > UINT32_MAX)
+    {
+        return false;
+    }
+
+    auto temporary = path;
+    temporary += ".tmp";
+
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            return false;
+        }
+
+        // zero padding up to each aligned offset
+        const char zeros[Alignment] = {};
+        uint64_t written = 0;
+        auto put = [&out, &written, &zeros](uint64_t at, const void* data, uint64_t bytes)
+        {
+            out.write(zeros, std::streamsize(at - written));
+            out.write(static_cast<const char*>(data), std::streamsize(bytes));
+            written = at + bytes;
+        };
+
+        put(0, &header, sizeof(header));
+        put(header.mItemOffset, level.mItems, uint64_t(level.mItemCount) * sizeof(ItemTemplate));
+        put(header.mProductOffset, level.mProducts, uint64_t(level.mProductCount) * sizeof(ProductTemplate));
+        put(header.mTextOffset, level.mText, level.mTextLength);
+
+        if (!out)
+        {
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    return !error;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file LevelFile.h
+ * @author Yeji Lee
+ *
+ * Compiled binary levels, mapped into memory and used in place.
+ */
+
+#ifndef LEVELFILE_H
+#define LEVELFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include "LevelTemplate.h"
+
+/**
+ * the fixed header at the start of a compiled level
+ *
+ * Offsets are in bytes from the start of the file, each a multiple of
+ * LevelFile::Alignment. The record sizes let a file written by a build
+ * with a different layout be refused instead of misread.
+ */
+struct LevelFileHeader
+{
+    char mMagic[4]; ///< LevelFile::Magic
+    uint32_t mVersion; ///< LevelFile::Version
+    uint32_t mItemSize; ///< sizeof(ItemTemplate) of the writer
+    uint32_t mProductSize; ///< sizeof(ProductTemplate) of the writer
+    int32_t mWidth; ///< virtual width
+    int32_t mHeight; ///< virtual height
+    uint32_t mItemCount; ///< number of items
+    uint32_t mItemOffset; ///< where the items start
+    uint32_t mProductCount; ///< number of products
+    uint32_t mProductOffset; ///< where the products start
+    uint32_t mTextLength; ///< bytes of text
+    uint32_t mTextOffset; ///< where the text starts
+};
+
+/**
+ * a compiled level, mapped read-only from its file
+ *
+ * The file is a LevelFileHeader followed by the item records, the
+ * product records and the text, each at an aligned offset. Open checks
+ * the header and that every item's products and text lie inside the
+ * file, then the records are read straight from the mapping; nothing
+ * is parsed or copied.
+ *
+ * Files are written in the byte order and struct layout of the machine
+ * that compiles them, so compile levels on the platform that plays them.
+ */
+class LevelFile : public LevelSource
+{
+public:
+    /// First bytes of every compiled level
+    static constexpr char Magic[4] = {'S', 'P', 'L', 'V'};
+
+    /// Format version, bumped when the records change
+    static const uint32_t Version = 1;
+
+    /// Extension of compiled level files
+    static constexpr const char* Extension = ".level";
+
+    /// Alignment of each array in the file
+    static const size_t Alignment = 8;
+
+private:
+    const char* mBegin = nullptr; ///< start of the mapping
+    size_t mSize = 0; ///< bytes mapped
+    void* mMapping = nullptr; ///< platform mapping handle, if it needs one
+    LevelData mData; ///< the level, pointing into the mapping
+
+    LevelFile() = default;
+    bool Check() const;
+
+public:
+    /// Copy constructor (disabled)
+    LevelFile(const LevelFile&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const LevelFile&) = delete;
+
+    ~LevelFile() override;
+
+    static std::shared_ptr<const LevelFile> Open(const std::filesystem::path& path);
+    static bool Write(const std::filesystem::path& path, const LevelData& level);
+
+    /**
+     * @return the level, pointing into the mapped file
+     */
+    LevelData GetData() const override { return mData; }
+};
+
+#endif //LEVELFILE_H
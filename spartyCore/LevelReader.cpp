@@ -0,0 +1,455 @@
+/**
+ * @file LevelReader.cpp
+ * @author Yeji Lee
+ */
+
+#include "LevelReader.h"
+#include "XmlPullParser.h"
+#include <charconv>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+/// Event of the pull parser
+typedef XmlPullParser::Event Event;
+
+/**
+ * strip the leading whitespace and plus sign strtol would accept
+ * @param text a number
+ * @return the number as std::from_chars takes it
+ */
+static std::string_view NumberStart(std::string_view text)
+{
+    while (!text.empty() && (text.front() == ' ' || text.front() == '\t' || text.front() == '\n'))
+    {
+        text.remove_prefix(1);
+    }
+    if (!text.empty() && text.front() == '+')
+    {
+        text.remove_prefix(1);
+    }
+    return text;
+}
+
+/**
+ * convert the number at the start of some text
+ *
+ * Like wxString::ToInt, anything after the number is ignored, and
+ * the value is left alone if there is no number at all.
+ *
+ * @param text the text
+ * @param value set to the number
+ */
+static void ParseNumber(std::string_view text, int32_t& value)
+{
+    text = NumberStart(text);
+    int32_t parsed;
+    if (std::from_chars(text.data(), text.data() + text.size(), parsed).ec == std::errc())
+    {
+        value = parsed;
+    }
+}
+
+/**
+ * convert the number at the start of some text
+ *
+ * @param text the text
+ * @param value set to the number, left alone if there is none
+ */
+static void ParseNumber(std::string_view text, double& value)
+{
+    text = NumberStart(text);
+#if defined(__cpp_lib_to_chars)
+    double parsed;
+    if (std::from_chars(text.data(), text.data() + text.size(), parsed).ec == std::errc())
+    {
+        value = parsed;
+    }
+#else
+    // no floating point std::from_chars in this standard library
+    std::string copy(text);
+    char* end;
+    double parsed = std::strtod(copy.c_str(), &end);
+    if (end != copy.c_str())
+    {
+        value = parsed;
+    }
+#endif
+}
+
+/**
+ * convert a pair of numbers such as "1100,400"
+ *
+ * @param text the text
+ * @param first set to the number before the comma
+ * @param second set to the number after it, left alone if there is no comma
+ */
+template <class T>
+static void ParsePair(std::string_view text, T& first, T& second)
+{
+    auto comma = text.find(',');
+    ParseNumber(text.substr(0, comma), first);
+    if (comma != std::string_view::npos)
+    {
+        ParseNumber(text.substr(comma + 1), second);
+    }
+}
+
+/**
+ * read a level
+ *
+ * @param in the XML document
+ * @return the level, nullptr if the document is not well formed
+ */
+std::shared_ptr<LevelTemplate> LevelReader::Read(std::istream& in)
+{
+    XmlPullParser parser(in);
+    auto level = std::make_shared<LevelTemplate>();
+    LevelReader reader(parser, *level);
+
+    if (parser.Next() != Event::StartElement)
+    {
+        return nullptr;
+    }
+
+    if (auto size = parser.FindAttribute("size"))
+    {
+        ParsePair(*size, level->mWidth, level->mHeight);
+    }
+
+    // children of the root element
+    while (parser.GetDepth() > 0)
+    {
+        auto event = parser.Next();
+        if (event == Event::Error || event == Event::EndDocument)
+        {
+            return nullptr;
+        }
+
+        if (event == Event::StartElement)
+        {
+            bool read = parser.GetName() == "items" ? reader.ReadItems() : reader.SkipElement();
+            if (!read)
+            {
+                return nullptr;
+            }
+        }
+    }
+
+    for (auto event = parser.Next(); event != Event::EndDocument; event = parser.Next())
+    {
+        if (event == Event::Error)
+        {
+            return nullptr;
+        }
+    }
+
+    return level;
+}
+
+/**
+ * read a level file
+ *
+ * @param path the XML file
+ * @return the level, nullptr if the file cannot be read or is not well formed
+ */
+std::shared_ptr<LevelTemplate> LevelReader::Read(const std::filesystem::path& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+    {
+        return nullptr;
+    }
+    return Read(in);
+}
+
+/**
+ * consume the rest of the element just started
+ * @return false if the document ends or is malformed first
+ */
+bool LevelReader::SkipElement()
+{
+    int depth = mParser.GetDepth();
+    while (mParser.GetDepth() >= depth)
+    {
+        auto event = mParser.Next();
+        if (event == Event::Error || event == Event::EndDocument)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * read the items element just started, adding each item as it ends
+ * @return false if the document is malformed
+ */
+bool LevelReader::ReadItems()
+{
+    int depth = mParser.GetDepth();
+    while (true)
+    {
+        auto event = mParser.Next();
+        if (event == Event::Error || event == Event::EndDocument)
+        {
+            return false;
+        }
+
+        if (event == Event::EndElement && mParser.GetDepth() < depth)
+        {
+            return true;
+        }
+
+        if (event == Event::StartElement)
+        {
+            ItemTemplate item;
+            if (!ReadItem(item))
+            {
+                return false;
+            }
+        }
+    }
+}
+
+/**
+ * read one item element just started and add it to the level
+ *
+ * @param item record to read it into
+ * @return false if the document is malformed
+ */
+bool LevelReader::ReadItem(ItemTemplate& item)
+{
+    // attributes go when the parser moves on, so they are read first
+    auto attribute = [this](const char* name)
+    {
+        auto value = mParser.FindAttribute(name);
+        return value != nullptr ? std::string_view(*value) : std::string_view();
+    };
+
+    ParseNumber(attribute("x"), item.mX);
+    ParseNumber(attribute("y"), item.mY);
+    ParsePair(attribute("p"), item.mPositionX, item.mPositionY);
+
+    const auto& name = mParser.GetName();
+    bool read;
+    if (name == "sensor")
+    {
+        item.mKind = ItemTemplate::Kind::Sensor;
+        read = ReadSensorOutputs(item);
+    }
+    else if (name == "conveyor")
+    {
+        item.mKind = ItemTemplate::Kind::Conveyor;
+        ParseNumber(attribute("speed"), item.mSpeed);
+        ParseNumber(attribute("height"), item.mHeight);
+        ParsePair(attribute("panel"), item.mPanelX, item.mPanelY);
+        read = ReadProducts(item);
+    }
+    else if (name == "scoreboard")
+    {
+        item.mKind = ItemTemplate::Kind::Scoreboard;
+        ParseNumber(attribute("good"), item.mGood);
+        ParseNumber(attribute("bad"), item.mBad);
+        read = ReadInstructions(item);
+    }
+    else if (name == "beam")
+    {
+        item.mKind = ItemTemplate::Kind::Beam;
+        ParseNumber(attribute("sender"), item.mSender);
+        read = SkipElement();
+    }
+    else if (name == "sparty")
+    {
+        item.mKind = ItemTemplate::Kind::Sparty;
+        ParseNumber(attribute("height"), item.mHeight);
+        ParseNumber(attribute("kick-duration"), item.mKickDuration);
+        ParseNumber(attribute("kick-speed"), item.mKickSpeed);
+        ParsePair(attribute("pin"), item.mPinX, item.mPinY);
+        read = SkipElement();
+    }
+    else
+    {
+        // not an item this game has
+        return SkipElement();
+    }
+
+    if (read)
+    {
+        mLevel.mItems.push_back(item);
+    }
+    return read;
+}
+
+/**
+ * read the products of the conveyor element just started
+ *
+ * @param conveyor the conveyor, given the run of products read
+ * @return false if the document is malformed
+ */
+bool LevelReader::ReadProducts(ItemTemplate& conveyor)
+{
+    typedef ProductModel::Properties Properties;
+
+    int depth = mParser.GetDepth();
+    int lastPlacement = 0;
+    conveyor.mFirstProduct = uint32_t(mLevel.mProducts.size());
+
+    while (true)
+    {
+        auto event = mParser.Next();
+        if (event == Event::Error || event == Event::EndDocument)
+        {
+            return false;
+        }
+
+        if (event == Event::EndElement && mParser.GetDepth() < depth)
+        {
+            break;
+        }
+
+        if (event != Event::StartElement)
+        {
+            continue;
+        }
+
+        if (mParser.GetDepth() == depth + 1 && mParser.GetName() == "product")
+        {
+            auto attribute = [this](const char* name, std::string_view fallback)
+            {
+                auto value = mParser.FindAttribute(name);
+                return value != nullptr ? std::string_view(*value) : fallback;
+            };
+
+            ProductTemplate product;
+
+            // "+N" is relative to the product before
+            auto placement = attribute("placement", "0");
+            if (!placement.empty() && placement.front() == '+')
+            {
+                int32_t delta = 0;
+                ParseNumber(placement.substr(1), delta);
+                product.mPlacement = lastPlacement + delta;
+            }
+            else
+            {
+                ParseNumber(placement, product.mPlacement);
+            }
+            lastPlacement = product.mPlacement;
+
+            auto shape = attribute("shape", "square");
+            product.mShape = shape == "circle" ? Properties::Circle
+                           : shape == "diamond" ? Properties::Diamond
+                           : Properties::Square;
+
+            auto color = attribute("color", "red");
+            product.mColor = color == "green" ? Properties::Green
+                           : color == "blue" ? Properties::Blue
+                           : Properties::Red;
+
+            auto content = attribute("content", "none");
+            product.mContent = content == "izzo" ? Properties::Izzo
+                             : content == "smith" ? Properties::Smith
+                             : content == "basketball" ? Properties::Basketball
+                             : content == "football" ? Properties::Football
+                             : Properties::None;
+
+            product.mKick = attribute("kick", "no") == "yes";
+
+            mLevel.mProducts.push_back(product);
+        }
+
+        if (!SkipElement())
+        {
+            return false;
+        }
+    }
+
+    conveyor.mProductCount = uint32_t(mLevel.mProducts.size()) - conveyor.mFirstProduct;
+    return true;
+}
+
+/**
+ * read the outputs of the sensor element just started, one per child element
+ *
+ * @param sensor the sensor, given the names of its outputs
+ * @return false if the document is malformed
+ */
+bool LevelReader::ReadSensorOutputs(ItemTemplate& sensor)
+{
+    int depth = mParser.GetDepth();
+    std::string outputs;
+
+    while (true)
+    {
+        auto event = mParser.Next();
+        if (event == Event::Error || event == Event::EndDocument)
+        {
+            return false;
+        }
+
+        if (event == Event::EndElement && mParser.GetDepth() < depth)
+        {
+            break;
+        }
+
+        if (event == Event::StartElement)
+        {
+            outputs += mParser.GetName() + " ";
+            if (!SkipElement())
+            {
+                return false;
+            }
+        }
+    }
+
+    mLevel.SetText(sensor, outputs);
+    return true;
+}
+
+/**
+ * read the instructions of the scoreboard element just started
+ *
+ * The instructions are its text, with a newline for each <br/>.
+ *
+ * @param scoreboard the scoreboard, given the instructions
+ * @return false if the document is malformed
+ */
+bool LevelReader::ReadInstructions(ItemTemplate& scoreboard)
+{
+    int depth = mParser.GetDepth();
+    std::string instructions;
+
+    while (true)
+    {
+        auto event = mParser.Next();
+        if (event == Event::Error || event == Event::EndDocument)
+        {
+            return false;
+        }
+
+        if (event == Event::EndElement && mParser.GetDepth() < depth)
+        {
+            break;
+        }
+
+        if (event == Event::Text && mParser.GetDepth() == depth)
+        {
+            instructions += mParser.GetText();
+        }
+        else if (event == Event::StartElement)
+        {
+            if (mParser.GetName() == "br")
+            {
+                instructions += "\n";
+            }
+            if (!SkipElement())
+            {
+                return false;
+            }
+        }
+    }
+
+    mLevel.SetText(scoreboard, instructions);
+    return true;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file LevelReader.h
+ * @author Yeji Lee
+ *
+ * Streaming reader of XML level files into a LevelTemplate.
+ */
+
+#ifndef LEVELREADER_H
+#define LEVELREADER_H
+
+#include <filesystem>
+#include <istream>
+#include <memory>
+#include "LevelTemplate.h"
+
+class XmlPullParser;
+
+/**
+ * reads the level schema straight from XML into a LevelTemplate
+ *
+ * The document goes through an XmlPullParser, so no tree of it is
+ * ever built. Each sensor, conveyor, product, beam, sparty and
+ * scoreboard is added to the level as soon as its element has been
+ * read, "+N" placements are resolved against the product before as
+ * they come, and numbers are converted with std::from_chars. Missing
+ * or unreadable attributes get the same defaults XMLParser used.
+ */
+class LevelReader
+{
+private:
+    XmlPullParser& mParser; ///< the document
+    LevelTemplate& mLevel; ///< the level being read
+
+    LevelReader(XmlPullParser& parser, LevelTemplate& level) : mParser(parser), mLevel(level) {}
+
+    bool ReadItems();
+    bool ReadItem(ItemTemplate& item);
+    bool ReadProducts(ItemTemplate& conveyor);
+    bool ReadSensorOutputs(ItemTemplate& sensor);
+    bool ReadInstructions(ItemTemplate& scoreboard);
+    bool SkipElement();
+
+public:
+    static std::shared_ptr<LevelTemplate> Read(std::istream& in);
+    static std::shared_ptr<LevelTemplate> Read(const std::filesystem::path& path);
+};
+
+#endif //LEVELREADER_H
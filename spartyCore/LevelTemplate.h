@@ -0,0 +1,161 @@
+/**
+ * @file LevelTemplate.h
+ * @author Yeji Lee
+ *
+ * Parsed description of a level, ready to be turned into items.
+ */
+
+#ifndef LEVELTEMPLATE_H
+#define LEVELTEMPLATE_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "ProductModel.h"
+
+/**
+ * a product as described by a level
+ *
+ * Placement is already resolved, so a "+150" placement is stored as
+ * the absolute distance from the bottom of the conveyor.
+ */
+struct ProductTemplate
+{
+    int32_t mPlacement = 0; ///< distance up the conveyor
+    ProductModel::Properties mShape = ProductModel::Properties::Square; ///< shape
+    ProductModel::Properties mColor = ProductModel::Properties::Red; ///< color
+    ProductModel::Properties mContent = ProductModel::Properties::None; ///< content
+    bool mKick = false; ///< should Sparty kick it
+};
+
+/**
+ * an item as described by a level
+ *
+ * One flat record for every kind of item; each kind reads only the
+ * fields it needs. Records hold no pointers and the fields are laid
+ * out without padding, so a LevelFile can be used straight from the
+ * mapped file.
+ */
+struct ItemTemplate
+{
+    /// the kinds of item a level can hold
+    enum class Kind : uint32_t { Sensor, Conveyor, Scoreboard, Beam, Sparty };
+
+    Kind mKind = Kind::Sensor; ///< which item this is
+    int32_t mX = 0; ///< x attribute
+    int32_t mY = 0; ///< y attribute
+    int32_t mSender = 0; ///< beam sender offset
+    double mPositionX = 0; ///< x of the p attribute
+    double mPositionY = 0; ///< y of the p attribute
+
+    int32_t mSpeed = 0; ///< conveyor speed
+    int32_t mHeight = 0; ///< conveyor or sparty height
+    int32_t mPanelX = 0; ///< conveyor panel x offset
+    int32_t mPanelY = 0; ///< conveyor panel y offset
+    uint32_t mFirstProduct = 0; ///< conveyor's first product in the level's products
+    uint32_t mProductCount = 0; ///< number of products on the conveyor
+
+    int32_t mGood = 0; ///< scoreboard good score
+    int32_t mBad = 0; ///< scoreboard bad score
+
+    int32_t mPinX = 0; ///< sparty pin x
+    int32_t mPinY = 0; ///< sparty pin y
+    double mKickDuration = 0; ///< sparty kick duration
+    double mKickSpeed = 0; ///< sparty kick speed
+
+    /// start in the level's text of the sensor outputs, separated by
+    /// spaces, or of the scoreboard instructions, in UTF-8
+    uint32_t mTextOffset = 0;
+    uint32_t mTextLength = 0; ///< length of the text in bytes
+};
+
+static_assert(std::is_trivially_copyable<ItemTemplate>::value, "ItemTemplate is written to level files as is");
+static_assert(sizeof(ItemTemplate) == 96, "ItemTemplate has no padding");
+static_assert(std::is_trivially_copyable<ProductTemplate>::value, "ProductTemplate is written to level files as is");
+
+/**
+ * a level's items, products and text, wherever they are stored
+ *
+ * Items are in file order. The products of all conveyors are in one
+ * array, each conveyor pointing at its own run of it.
+ */
+struct LevelData
+{
+    int32_t mWidth = 0; ///< virtual width
+    int32_t mHeight = 0; ///< virtual height
+    const ItemTemplate* mItems = nullptr; ///< the items
+    uint32_t mItemCount = 0; ///< number of items
+    const ProductTemplate* mProducts = nullptr; ///< products of every conveyor
+    uint32_t mProductCount = 0; ///< number of products
+    const char* mText = nullptr; ///< text of every item
+    uint32_t mTextLength = 0; ///< bytes of text
+
+    /**
+     * @param item an item of this level
+     * @return its text
+     */
+    std::string_view GetText(const ItemTemplate& item) const
+    {
+        return std::string_view(mText + item.mTextOffset, item.mTextLength);
+    }
+};
+
+/**
+ * something a level can be built from: a parsed level or a level file
+ */
+class LevelSource
+{
+public:
+    virtual ~LevelSource() = default;
+
+    /**
+     * @return the level, valid as long as this source is
+     */
+    virtual LevelData GetData() const = 0;
+};
+
+/**
+ * everything needed to build a level without its file, built by parsing
+ */
+class LevelTemplate : public LevelSource
+{
+public:
+    int32_t mWidth = 0; ///< virtual width
+    int32_t mHeight = 0; ///< virtual height
+    std::vector<ItemTemplate> mItems; ///< the items
+    std::vector<ProductTemplate> mProducts; ///< products of every conveyor
+    std::string mText; ///< text of every item, in UTF-8
+
+    /**
+     * give an item its text
+     * @param item the item
+     * @param text the text, in UTF-8
+     */
+    void SetText(ItemTemplate& item, std::string_view text)
+    {
+        item.mTextOffset = uint32_t(mText.size());
+        item.mTextLength = uint32_t(text.size());
+        mText.append(text);
+    }
+
+    /**
+     * @return the level
+     */
+    LevelData GetData() const override
+    {
+        LevelData data;
+        data.mWidth = mWidth;
+        data.mHeight = mHeight;
+        data.mItems = mItems.data();
+        data.mItemCount = uint32_t(mItems.size());
+        data.mProducts = mProducts.data();
+        data.mProductCount = uint32_t(mProducts.size());
+        data.mText = mText.data();
+        data.mTextLength = uint32_t(mText.size());
+        return data;
+    }
+};
+
+#endif //LEVELTEMPLATE_H
@@ -0,0 +1,53 @@
+/**
+ * @file LevelTemplateCache.cpp
+ * @author Yeji Lee
+ */
+
+#include "LevelTemplateCache.h"
+
+/**
+ * look up a level
+ *
+ * @param path the level file
+ * @return the loaded level, nullptr if it is not cached or the file changed
+ */
+std::shared_ptr<const LevelSource> LevelTemplateCache::Find(const std::filesystem::path& path) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto entry = mEntries.find(path);
+    if (entry == mEntries.end())
+    {
+        return nullptr;
+    }
+
+    std::error_code error;
+    auto time = std::filesystem::last_write_time(path, error);
+    if (error || time != entry->second.mTime)
+    {
+        return nullptr;
+    }
+
+    return entry->second.mLevel;
+}
+
+/**
+ * remember a level loaded from a file
+ *
+ * Call this with the file as it was loaded; the time stored is the
+ * file's modification time now.
+ *
+ * @param path the level file
+ * @param level the loaded level
+ */
+void LevelTemplateCache::Store(const std::filesystem::path& path, std::shared_ptr<const LevelSource> level)
+{
+    std::error_code error;
+    auto time = std::filesystem::last_write_time(path, error);
+    if (error)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    mEntries[path] = {time, std::move(level)};
+}
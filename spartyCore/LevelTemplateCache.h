@@ -0,0 +1,70 @@
+/**
+ * @file LevelTemplateCache.h
+ * @author Yeji Lee
+ *
+ * Loaded levels kept in memory, keyed by file and modification time.
+ */
+
+#ifndef LEVELTEMPLATECACHE_H
+#define LEVELTEMPLATECACHE_H
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include "LevelTemplate.h"
+
+/**
+ * loaded levels by file path
+ *
+ * A level is either parsed from XML into a LevelTemplate or mapped
+ * from a compiled LevelFile; either way it is kept here as a source
+ * to build the level's items from.
+ *
+ * Each entry remembers the modification time of its file when it
+ * was stored. Find only hands an entry back while the file still has
+ * that time, so editing a level on disk gets it parsed again.
+ *
+ * A worker thread may parse the next level and Store it while the
+ * current one is played, so every call takes the cache's lock.
+ */
+class LevelTemplateCache
+{
+private:
+    /// a cached level
+    struct Entry
+    {
+        std::filesystem::file_time_type mTime; ///< modification time of the file
+        std::shared_ptr<const LevelSource> mLevel; ///< the loaded level
+    };
+
+    /// entries by path
+    std::map<std::filesystem::path, Entry> mEntries;
+
+    /// guards mEntries
+    mutable std::mutex mMutex;
+
+public:
+    std::shared_ptr<const LevelSource> Find(const std::filesystem::path& path) const;
+    void Store(const std::filesystem::path& path, std::shared_ptr<const LevelSource> level);
+
+    /**
+     * forget every level
+     */
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.clear();
+    }
+
+    /**
+     * @return number of levels cached
+     */
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mEntries.size();
+    }
+};
+
+#endif //LEVELTEMPLATECACHE_H
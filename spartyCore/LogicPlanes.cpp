@@ -0,0 +1,338 @@
+/**
+ * @file LogicPlanes.cpp
+ * @author Yeji Lee
+ *
+ * The plane kernels follow GateLogic.h: any Unknown input makes the
+ * output Unknown, so the output is known only where both inputs are,
+ * and the value plane is masked by it to keep Unknown as (0, 0).
+ */
+
+#include "LogicPlanes.h"
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SPARTY_PLANES_SSE2
+#endif
+
+/// Bits in one plane word
+const size_t WordBits = 64;
+
+/**
+ * constructor, every net starts out Unknown in every scenario
+ * @param nets number of nets
+ * @param scenarios number of scenarios, rounded up to whole words
+ */
+LogicPlanes::LogicPlanes(size_t nets, size_t scenarios) :
+    mNets(nets), mWords((scenarios + WordBits - 1) / WordBits),
+    mKnown(nets * mWords, 0), mValue(nets * mWords, 0)
+{
+}
+
+/**
+ * set every net in every scenario to one state
+ * @param state the state
+ */
+void LogicPlanes::Fill(States state)
+{
+    mKnown.assign(mKnown.size(), state == States::Unknown ? 0 : ~uint64_t(0));
+    mValue.assign(mValue.size(), state == States::One ? ~uint64_t(0) : 0);
+}
+
+/**
+ * set a net to one state in every scenario
+ * @param net the net number
+ * @param state the state
+ */
+void LogicPlanes::FillNet(uint32_t net, States state)
+{
+    std::fill_n(Known(net), mWords, state == States::Unknown ? 0 : ~uint64_t(0));
+    std::fill_n(Value(net), mWords, state == States::One ? ~uint64_t(0) : 0);
+}
+
+/**
+ * set a net in one scenario
+ * @param net the net number
+ * @param scenario the scenario
+ * @param state the new state
+ */
+void LogicPlanes::Set(uint32_t net, size_t scenario, States state)
+{
+    size_t word = net * mWords + scenario / WordBits;
+    uint64_t bit = uint64_t(1) << (scenario % WordBits);
+
+    mKnown[word] &= ~bit;
+    mValue[word] &= ~bit;
+    if (state != States::Unknown)
+    {
+        mKnown[word] |= bit;
+    }
+    if (state == States::One)
+    {
+        mValue[word] |= bit;
+    }
+}
+
+/**
+ * get a net in one scenario
+ * @param net the net number
+ * @param scenario the scenario
+ * @return the state
+ */
+States LogicPlanes::Get(uint32_t net, size_t scenario) const
+{
+    size_t word = net * mWords + scenario / WordBits;
+    uint64_t bit = uint64_t(1) << (scenario % WordBits);
+
+    if ((mKnown[word] & bit) == 0)
+    {
+        return States::Unknown;
+    }
+    return (mValue[word] & bit) ? States::One : States::Zero;
+}
+
+/**
+ * OR over plane words, one word at a time
+ * @param knownA known plane of the first input
+ * @param valueA value plane of the first input
+ * @param knownB known plane of the second input
+ * @param valueB value plane of the second input
+ * @param knownOut known plane of the output
+ * @param valueOut value plane of the output
+ * @param words number of words in each plane
+ */
+void PlaneOrScalar(const uint64_t* knownA, const uint64_t* valueA,
+                   const uint64_t* knownB, const uint64_t* valueB,
+                   uint64_t* knownOut, uint64_t* valueOut, size_t words)
+{
+    for (size_t i = 0; i < words; i++)
+    {
+        uint64_t known = knownA[i] & knownB[i];
+        knownOut[i] = known;
+        valueOut[i] = (valueA[i] | valueB[i]) & known;
+    }
+}
+
+/**
+ * AND over plane words, one word at a time
+ * @param knownA known plane of the first input
+ * @param valueA value plane of the first input
+ * @param knownB known plane of the second input
+ * @param valueB value plane of the second input
+ * @param knownOut known plane of the output
+ * @param valueOut value plane of the output
+ * @param words number of words in each plane
+ */
+void PlaneAndScalar(const uint64_t* knownA, const uint64_t* valueA,
+                    const uint64_t* knownB, const uint64_t* valueB,
+                    uint64_t* knownOut, uint64_t* valueOut, size_t words)
+{
+    for (size_t i = 0; i < words; i++)
+    {
+        uint64_t known = knownA[i] & knownB[i];
+        knownOut[i] = known;
+        valueOut[i] = valueA[i] & valueB[i] & known;
+    }
+}
+
+/**
+ * NOT over plane words, one word at a time
+ * @param knownA known plane of the input
+ * @param valueA value plane of the input
+ * @param knownOut known plane of the output
+ * @param valueOut value plane of the output
+ * @param words number of words in each plane
+ */
+void PlaneNotScalar(const uint64_t* knownA, const uint64_t* valueA,
+                    uint64_t* knownOut, uint64_t* valueOut, size_t words)
+{
+    for (size_t i = 0; i < words; i++)
+    {
+        uint64_t known = knownA[i];
+        knownOut[i] = known;
+        valueOut[i] = ~valueA[i] & known;
+    }
+}
+
+#if defined(__AVX2__)
+
+/// Plane words in one AVX2 register
+const size_t VectorWords = 4;
+
+/**
+ * @return name of the instruction set the plane kernels were built for
+ */
+const char* PlaneKernelName()
+{
+    return "AVX2";
+}
+
+/// load four plane words
+#define LOAD(p) _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))
+/// store four plane words
+#define STORE(p, v) _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v)
+/// bitwise and of two registers
+#define AND(a, b) _mm256_and_si256(a, b)
+/// bitwise or of two registers
+#define OR(a, b) _mm256_or_si256(a, b)
+/// (not a) and b
+#define ANDNOT(a, b) _mm256_andnot_si256(a, b)
+
+#elif defined(SPARTY_PLANES_SSE2)
+
+/// Plane words in one SSE2 register
+const size_t VectorWords = 2;
+
+/**
+ * @return name of the instruction set the plane kernels were built for
+ */
+const char* PlaneKernelName()
+{
+    return "SSE2";
+}
+
+/// load two plane words
+#define LOAD(p) _mm_loadu_si128(reinterpret_cast<const __m128i*>(p))
+/// store two plane words
+#define STORE(p, v) _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v)
+/// bitwise and of two registers
+#define AND(a, b) _mm_and_si128(a, b)
+/// bitwise or of two registers
+#define OR(a, b) _mm_or_si128(a, b)
+/// (not a) and b
+#define ANDNOT(a, b) _mm_andnot_si128(a, b)
+
+#endif
+
+#if defined(LOAD)
+
+/**
+ * OR over plane words, a register at a time
+ * @param knownA known plane of the first input
+ * @param valueA value plane of the first input
+ * @param knownB known plane of the second input
+ * @param valueB value plane of the second input
+ * @param knownOut known plane of the output
+ * @param valueOut value plane of the output
+ * @param words number of words in each plane
+ */
+void PlaneOr(const uint64_t* knownA, const uint64_t* valueA,
+             const uint64_t* knownB, const uint64_t* valueB,
+             uint64_t* knownOut, uint64_t* valueOut, size_t words)
+{
+    size_t i = 0;
+    for (; i + VectorWords <= words; i += VectorWords)
+    {
+        auto known = AND(LOAD(knownA + i), LOAD(knownB + i));
+        STORE(knownOut + i, known);
+        STORE(valueOut + i, AND(OR(LOAD(valueA + i), LOAD(valueB + i)), known));
+    }
+    PlaneOrScalar(knownA + i, valueA + i, knownB + i, valueB + i, knownOut + i, valueOut + i, words - i);
+}
+
+/**
+ * AND over plane words, a register at a time
+ * @param knownA known plane of the first input
+ * @param valueA value plane of the first input
+ * @param knownB known plane of the second input
+ * @param valueB value plane of the second input
+ * @param knownOut known plane of the output
+ * @param valueOut value plane of the output
+ * @param words number of words in each plane
+ */
+void PlaneAnd(const uint64_t* knownA, const uint64_t* valueA,
+              const uint64_t* knownB, const uint64_t* valueB,
+              uint64_t* knownOut, uint64_t* valueOut, size_t words)
+{
+    size_t i = 0;
+    for (; i + VectorWords <= words; i += VectorWords)
+    {
+        auto known = AND(LOAD(knownA + i), LOAD(knownB + i));
+        STORE(knownOut + i, known);
+        STORE(valueOut + i, AND(AND(LOAD(valueA + i), LOAD(valueB + i)), known));
+    }
+    PlaneAndScalar(knownA + i, valueA + i, knownB + i, valueB + i, knownOut + i, valueOut + i, words - i);
+}
+
+/**
+ * NOT over plane words, a register at a time
+ * @param knownA known plane of the input
+ * @param valueA value plane of the input
+ * @param knownOut known plane of the output
+ * @param valueOut value plane of the output
+ * @param words number of words in each plane
+ */
+void PlaneNot(const uint64_t* knownA, const uint64_t* valueA,
+              uint64_t* knownOut, uint64_t* valueOut, size_t words)
+{
+    size_t i = 0;
+    for (; i + VectorWords <= words; i += VectorWords)
+    {
+        auto known = LOAD(knownA + i);
+        STORE(knownOut + i, known);
+        STORE(valueOut + i, ANDNOT(LOAD(valueA + i), known));
+    }
+    PlaneNotScalar(knownA + i, valueA + i, knownOut + i, valueOut + i, words - i);
+}
+
+#else
+
+/**
+ * @return name of the instruction set the plane kernels were built for
+ */
+const char* PlaneKernelName()
+{
+    return "scalar";
+}
+
+/**
+ * OR over plane words
+ * @param knownA known plane of the first input
+ * @param valueA value plane of the first input
+ * @param knownB known plane of the second input
+ * @param valueB value plane of the second input
+ * @param knownOut known plane of the output
+ * @param valueOut value plane of the output
+ * @param words number of words in each plane
+ */
+void PlaneOr(const uint64_t* knownA, const uint64_t* valueA,
+             const uint64_t* knownB, const uint64_t* valueB,
+             uint64_t* knownOut, uint64_t* valueOut, size_t words)
+{
+    PlaneOrScalar(knownA, valueA, knownB, valueB, knownOut, valueOut, words);
+}
+
+/**
+ * AND over plane words
+ * @param knownA known plane of the first input
+ * @param valueA value plane of the first input
+ * @param knownB known plane of the second input
+ * @param valueB value plane of the second input
+ * @param knownOut known plane of the output
+ * @param valueOut value plane of the output
+ * @param words number of words in each plane
+ */
+void PlaneAnd(const uint64_t* knownA, const uint64_t* valueA,
+              const uint64_t* knownB, const uint64_t* valueB,
+              uint64_t* knownOut, uint64_t* valueOut, size_t words)
+{
+    PlaneAndScalar(knownA, valueA, knownB, valueB, knownOut, valueOut, words);
+}
+
+/**
+ * NOT over plane words
+ * @param knownA known plane of the input
+ * @param valueA value plane of the input
+ * @param knownOut known plane of the output
+ * @param valueOut value plane of the output
+ * @param words number of words in each plane
+ */
+void PlaneNot(const uint64_t* knownA, const uint64_t* valueA,
+              uint64_t* knownOut, uint64_t* valueOut, size_t words)
+{
+    PlaneNotScalar(knownA, valueA, knownOut, valueOut, words);
+}
+
+#endif
@@ -0,0 +1,89 @@
+/**
+ * @file LogicPlanes.h
+ * @author Yeji Lee
+ *
+ * Three-valued states for many scenarios at once, stored as two bit
+ * planes per net.
+ */
+
+#ifndef LOGICPLANES_H
+#define LOGICPLANES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "States.h"
+
+/**
+ * The state of every net in a number of independent scenarios.
+ *
+ * Each net has a known plane and a value plane, one bit per scenario:
+ *
+ *     known  value  state
+ *       1      1    One
+ *       1      0    Zero
+ *       0      0    Unknown
+ *
+ * A net's words are contiguous, so a gate over all scenarios is a run
+ * of word operations that the plane kernels vectorize.
+ */
+class LogicPlanes
+{
+private:
+    size_t mNets; ///< number of nets
+    size_t mWords; ///< 64 bit words per net in each plane
+    std::vector<uint64_t> mKnown; ///< known plane, mWords words per net
+    std::vector<uint64_t> mValue; ///< value plane, mWords words per net
+
+public:
+    LogicPlanes(size_t nets, size_t scenarios);
+
+    void Fill(States state);
+    void FillNet(uint32_t net, States state);
+    void Set(uint32_t net, size_t scenario, States state);
+    States Get(uint32_t net, size_t scenario) const;
+
+    /**
+     * @param net the net number
+     * @return the known words of a net
+     */
+    uint64_t* Known(uint32_t net) { return mKnown.data() + net * mWords; }
+
+    /**
+     * @param net the net number
+     * @return the value words of a net
+     */
+    uint64_t* Value(uint32_t net) { return mValue.data() + net * mWords; }
+
+    /**
+     * @return number of nets
+     */
+    size_t GetNetCount() const { return mNets; }
+
+    /**
+     * @return words per net in each plane
+     */
+    size_t GetWords() const { return mWords; }
+};
+
+void PlaneOr(const uint64_t* knownA, const uint64_t* valueA,
+             const uint64_t* knownB, const uint64_t* valueB,
+             uint64_t* knownOut, uint64_t* valueOut, size_t words);
+void PlaneAnd(const uint64_t* knownA, const uint64_t* valueA,
+              const uint64_t* knownB, const uint64_t* valueB,
+              uint64_t* knownOut, uint64_t* valueOut, size_t words);
+void PlaneNot(const uint64_t* knownA, const uint64_t* valueA,
+              uint64_t* knownOut, uint64_t* valueOut, size_t words);
+
+void PlaneOrScalar(const uint64_t* knownA, const uint64_t* valueA,
+                   const uint64_t* knownB, const uint64_t* valueB,
+                   uint64_t* knownOut, uint64_t* valueOut, size_t words);
+void PlaneAndScalar(const uint64_t* knownA, const uint64_t* valueA,
+                    const uint64_t* knownB, const uint64_t* valueB,
+                    uint64_t* knownOut, uint64_t* valueOut, size_t words);
+void PlaneNotScalar(const uint64_t* knownA, const uint64_t* valueA,
+                    uint64_t* knownOut, uint64_t* valueOut, size_t words);
+
+const char* PlaneKernelName();
+
+#endif //LOGICPLANES_H
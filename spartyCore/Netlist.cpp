@@ -0,0 +1,160 @@
+/**
+ * @file Netlist.cpp
+ * @author Yeji Lee
+ */
+
+#include "Netlist.h"
+
+/**
+ * remove every pin and wire
+ */
+void Netlist::Clear()
+{
+    mDrivers.clear();
+    mOutputCount = 0;
+    mFanoutStarts.assign(1, 0);
+    mFanout.clear();
+    mDirty = false;
+}
+
+/**
+ * set the number of pins, keeping the wires of the pins that remain
+ * @param outputs number of output pins
+ * @param inputs number of input pins
+ */
+void Netlist::Resize(size_t outputs, size_t inputs)
+{
+    if (outputs < mOutputCount)
+    {
+        for (auto& driver : mDrivers)
+        {
+            if (driver != NoPin && driver >= outputs)
+            {
+                driver = NoPin;
+            }
+        }
+    }
+
+    mOutputCount = outputs;
+    mDrivers.resize(inputs, NoPin);
+    mDirty = true;
+}
+
+/**
+ * wire an output to an input, replacing the wire already on the input
+ * @param output the output pin
+ * @param input the input pin
+ */
+void Netlist::Connect(uint32_t output, uint32_t input)
+{
+    if (mDrivers[input] != output)
+    {
+        mDrivers[input] = output;
+        mDirty = true;
+    }
+}
+
+/**
+ * remove the wire from an output to an input, if there is one
+ * @param output the output pin
+ * @param input the input pin
+ */
+void Netlist::Disconnect(uint32_t output, uint32_t input)
+{
+    if (mDrivers[input] == output)
+    {
+        mDrivers[input] = NoPin;
+        mDirty = true;
+    }
+}
+
+/**
+ * remove every wire out of an output, for when the pin goes away
+ * @param output the output pin
+ */
+void Netlist::RemoveOutput(uint32_t output)
+{
+    if (output >= mOutputCount)
+    {
+        return;
+    }
+
+    for (auto input : GetFanout(output))
+    {
+        mDrivers[input] = NoPin;
+    }
+    mDirty = true;
+}
+
+/**
+ * remove the wire into an input, for when the pin goes away
+ * @param input the input pin
+ */
+void Netlist::RemoveInput(uint32_t input)
+{
+    if (input < mDrivers.size() && mDrivers[input] != NoPin)
+    {
+        mDrivers[input] = NoPin;
+        mDirty = true;
+    }
+}
+
+/**
+ * get the inputs an output drives
+ * @param output the output pin
+ * @return the input pins, in increasing order
+ */
+Netlist::Fanout Netlist::GetFanout(uint32_t output) const
+{
+    if (mDirty)
+    {
+        Rebuild();
+    }
+
+    const uint32_t* fanout = mFanout.data();
+    return Fanout(fanout + mFanoutStarts[output], fanout + mFanoutStarts[output + 1]);
+}
+
+/**
+ * @return number of wires
+ */
+size_t Netlist::GetWireCount() const
+{
+    if (mDirty)
+    {
+        Rebuild();
+    }
+
+    return mFanout.size();
+}
+
+/**
+ * rebuild the fan-out arrays from the drivers, counting then filling
+ */
+void Netlist::Rebuild() const
+{
+    mFanoutStarts.assign(mOutputCount + 1, 0);
+    for (auto driver : mDrivers)
+    {
+        if (driver != NoPin)
+        {
+            mFanoutStarts[driver + 1]++;
+        }
+    }
+    for (size_t output = 0; output < mOutputCount; output++)
+    {
+        mFanoutStarts[output + 1] += mFanoutStarts[output];
+    }
+
+    mFanout.resize(mFanoutStarts.back());
+    std::vector<uint32_t> fill(mFanoutStarts.begin(), mFanoutStarts.end() - 1);
+    for (uint32_t input = 0; input < mDrivers.size(); input++)
+    {
+        if (mDrivers[input] != NoPin)
+        {
+            mFanout[fill[mDrivers[input]]++] = input;
+        }
+    }
+
+    mDirty = false;
+}
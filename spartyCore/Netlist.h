@@ -0,0 +1,105 @@
+/**
+ * @file Netlist.h
+ * @author Yeji Lee
+ *
+ * Wire connectivity between pins, stored as flat arrays.
+ */
+
+#ifndef NETLIST_H
+#define NETLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * The wires of a circuit, by integer pin ID.
+ *
+ * Output pins and input pins are numbered separately from zero. Each
+ * input is driven by at most one output, which is the record kept
+ * when wires are added or removed. The fan-out of every output, the
+ * direction drawing and evaluation walk, is kept in compressed sparse
+ * row form: the inputs of output i are mFanout[mFanoutStarts[i]] up to
+ * mFanout[mFanoutStarts[i + 1]]. It is rebuilt from the drivers the
+ * first time it is needed after an edit.
+ */
+class Netlist
+{
+public:
+    /// ID of no pin, the driver of an unwired input
+    static constexpr uint32_t NoPin = UINT32_MAX;
+
+    /**
+     * the input pins one output drives
+     */
+    class Fanout
+    {
+    private:
+        const uint32_t* mBegin; ///< first input pin
+        const uint32_t* mEnd; ///< one past the last input pin
+
+    public:
+        /**
+         * constructor
+         * @param begin first input pin
+         * @param end one past the last input pin
+         */
+        Fanout(const uint32_t* begin, const uint32_t* end) : mBegin(begin), mEnd(end) {}
+
+        /// @return first input pin
+        const uint32_t* begin() const { return mBegin; }
+
+        /// @return one past the last input pin
+        const uint32_t* end() const { return mEnd; }
+
+        /// @return number of input pins
+        size_t size() const { return mEnd - mBegin; }
+
+        /// @return true if the output drives nothing
+        bool empty() const { return mBegin == mEnd; }
+    };
+
+private:
+    /// output driving each input pin, NoPin if it is not wired
+    std::vector<uint32_t> mDrivers;
+    /// number of output pins
+    size_t mOutputCount = 0;
+    /// index in mFanout where each output's inputs start, one past the last output at the end
+    mutable std::vector<uint32_t> mFanoutStarts;
+    /// input pins driven by each output, grouped by output
+    mutable std::vector<uint32_t> mFanout;
+    /// do the fan-out arrays need rebuilding
+    mutable bool mDirty = true;
+
+    void Rebuild() const;
+
+public:
+    void Clear();
+    void Resize(size_t outputs, size_t inputs);
+    void Connect(uint32_t output, uint32_t input);
+    void Disconnect(uint32_t output, uint32_t input);
+    void RemoveOutput(uint32_t output);
+    void RemoveInput(uint32_t input);
+    Fanout GetFanout(uint32_t output) const;
+
+    /**
+     * get the output that drives an input
+     * @param input the input pin
+     * @return the output pin, NoPin if the input is not wired
+     */
+    uint32_t GetDriver(uint32_t input) const { return mDrivers[input]; }
+
+    /**
+     * @return number of output pins
+     */
+    size_t GetOutputCount() const { return mOutputCount; }
+
+    /**
+     * @return number of input pins
+     */
+    size_t GetInputCount() const { return mDrivers.size(); }
+
+    size_t GetWireCount() const;
+};
+
+#endif //NETLIST_H
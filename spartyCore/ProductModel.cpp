@@ -0,0 +1,207 @@
+/**
+ * @file ProductModel.cpp
+ * @author Yeji Lee
+ */
+
+#include "ProductModel.h"
+#include "ConveyorModel.h"
+
+/// Delay after last product has left beam or
+/// been kicked before we end the level.
+const double LastProductDelay = 3;
+
+/**
+ * constructor
+ *
+ * @param placement the placement of the product on the conveyor
+ * @param shape the shape of the product
+ * @param color the color of the product
+ * @param content the content inside the product
+ * @param kick whether the product should be kicked
+ */
+ProductModel::ProductModel(int placement, Properties shape, Properties color, Properties content, bool kick)
+    : mPlacement(placement), mStore(std::make_shared<ProductStore>())
+{
+    auto properties = uint16_t(int(shape) | int(color) << PropertyBits | int(content) << (2 * PropertyBits));
+    uint8_t flags = ProductStore::OnConveyor;
+    if (kick)
+    {
+        flags |= ProductStore::Kick;
+    }
+    mRow = mStore->Add(properties, flags, this);
+}
+
+/**
+ * destructor, removes the product's row from its store
+ */
+ProductModel::~ProductModel()
+{
+    mStore->Remove(mRow);
+}
+
+/**
+ * update the product for one step of the simulation
+ *
+ * A product on a conveyor is moved along with the rest of the
+ * conveyor's products by ConveyorModel::Update, so this only moves
+ * a product that is on no conveyor. Crossing the beams is detected
+ * for all products at once by Simulation::UpdateBeams.
+ *
+ * @param elapsed the time since the last update
+ * @return true if the level ending delay ran out during this update
+ */
+bool ProductModel::Update(double elapsed)
+{
+    if (mConveyor != nullptr)
+    {
+        return false;
+    }
+
+    Move(elapsed);
+    return UpdateLastProductDelay(elapsed);
+}
+
+/**
+ * move the product by its kick velocity, for a product on no conveyor
+ *
+ * @param elapsed the time since the last update
+ */
+void ProductModel::Move(double elapsed)
+{
+    if (mConveyor == nullptr)
+    {
+        mStore->Move(elapsed, 0);
+    }
+}
+
+/**
+ * count down the delay started when the last product passes the beam,
+ * for a product on no conveyor
+ *
+ * @param elapsed the time since the last update
+ * @return true if the delay ran out during this update
+ */
+bool ProductModel::UpdateLastProductDelay(double elapsed)
+{
+    return mConveyor == nullptr && mStore->UpdateLastDelays(elapsed);
+}
+
+/**
+ * Logic for after the product passes the beam
+ */
+void ProductModel::HasPassedBeam()
+{
+    if (mStore->mFlags[mRow] & ProductStore::Last)
+    {
+        mStore->StartLastDelay(mRow, LastProductDelay);
+    }
+}
+
+/**
+ * set the location of the product, also remembered as its reset location
+ *
+ * @param x the x location
+ * @param y the y location
+ */
+void ProductModel::SetLocation(double x, double y)
+{
+    mStore->mInitialX[mRow] = x;
+    mStore->mInitialY[mRow] = y;
+    mStore->mX[mRow] = x;
+    mStore->mY[mRow] = y;
+}
+
+/**
+ * reset the position of the product
+ */
+void ProductModel::ResetPosition()
+{
+    mStore->mX[mRow] = mStore->mInitialX[mRow];
+    mStore->mY[mRow] = mStore->mInitialY[mRow];
+}
+
+/**
+ * set the product to be kicked
+ *
+ * @param kicked whether the product should be kicked
+ * @param kickSpeed the speed at which the product should be kicked
+ */
+void ProductModel::SetKicked(bool kicked, double kickSpeed)
+{
+    if (kicked)
+    {
+        mStore->mFlags[mRow] |= ProductStore::Kick;
+        mStore->mVelocityX[mRow] = kickSpeed;
+    }
+    else
+    {
+        mStore->mFlags[mRow] &= ~ProductStore::Kick;
+        mStore->mVelocityX[mRow] = 0;
+    }
+}
+
+/**
+ * set the product to be on the conveyor
+ *
+ * The conveyor moves the products on it at its own speed.
+ *
+ * @param onConveyor whether the product is on the conveyor
+ */
+void ProductModel::SetOnConveyor(bool onConveyor)
+{
+    if (onConveyor)
+    {
+        mStore->mFlags[mRow] |= ProductStore::OnConveyor;
+    }
+    else
+    {
+        mStore->mFlags[mRow] &= ~ProductStore::OnConveyor;
+    }
+    mStore->UpdateBelt(mRow);
+}
+
+/**
+ * put the product on a conveyor, moving its row to the conveyor's store
+ *
+ * @param conveyor the conveyor, nullptr to take it off any conveyor
+ */
+void ProductModel::SetConveyor(ConveyorModel* conveyor)
+{
+    if (conveyor == mConveyor)
+    {
+        return;
+    }
+
+    auto store = conveyor != nullptr ? conveyor->GetProducts() : std::make_shared<ProductStore>();
+    auto row = store->CopyRow(*mStore, mRow);
+    mStore->Remove(mRow);
+
+    mStore = store;
+    mRow = row;
+    mConveyor = conveyor;
+}
+
+/**
+ * mark this product as the last one on its conveyor
+ * @param isLast true if this is the last product
+ */
+void ProductModel::SetLast(bool isLast)
+{
+    mStore->SetLast(mRow, isLast);
+}
+
+/**
+ * set if the product has passed the beam
+ * @param passed true if the product has passed the beam
+ */
+void ProductModel::SetPassedBeam(bool passed)
+{
+    if (passed)
+    {
+        mStore->mFlags[mRow] |= ProductStore::PassedBeam;
+    }
+    else
+    {
+        mStore->mFlags[mRow] &= ~ProductStore::PassedBeam;
+    }
+}
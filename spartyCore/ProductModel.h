@@ -0,0 +1,183 @@
+/**
+ * @file ProductModel.h
+ * @author Yeji Lee
+ *
+ * Simulation state of a product moving down a conveyor.
+ * Product draws one of these, the headless Simulation updates it.
+ */
+
+#ifndef PRODUCTMODEL_H
+#define PRODUCTMODEL_H
+
+#include <cstdint>
+#include <memory>
+#include "ProductStore.h"
+
+class ConveyorModel;
+
+/// Default product size in pixels
+const double ProductDefaultSize = 80.0;
+
+/**
+ * wxWidgets-free state and movement of a single product
+ *
+ * The moving state lives in a row of a ProductStore. Once the product
+ * is put on a conveyor that is the conveyor's store, which moves all
+ * of its products at once; until then the product has a store of its
+ * own. Everything here reads and writes that row.
+ */
+class ProductModel
+{
+public:
+    /**
+     * possible product properties
+     * None property allows to indicate that the product has no content
+     */
+    enum class Properties
+    {
+        None, Red, Green, Blue, White, Square, Circle, Diamond,
+        Izzo, Smith, Football, Basketball
+    };
+
+    /**
+     * property types
+     */
+    enum class Types { Color, Shape, Content };
+
+    ProductModel(int placement, Properties shape, Properties color, Properties content, bool kick);
+
+    /// Default constructor (disabled)
+    ProductModel() = delete;
+
+    /// Copy constructor (disabled)
+    ProductModel(const ProductModel&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const ProductModel&) = delete;
+
+    ~ProductModel();
+
+    bool Update(double elapsed);
+    void Move(double elapsed);
+    bool UpdateLastProductDelay(double elapsed);
+    void HasPassedBeam();
+
+    void SetLocation(double x, double y);
+    void ResetPosition();
+    void SetKicked(bool kicked, double kickSpeed);
+    void SetOnConveyor(bool onConveyor);
+    void SetConveyor(ConveyorModel* conveyor);
+    void SetLast(bool isLast);
+
+    /**
+     * get the placement of the product on the conveyor
+     * @return placement in pixels
+     */
+    int GetPlacement() const { return mPlacement; }
+
+    /**
+     * get the shape of the product
+     * @return the shape property
+     */
+    Properties GetShape() const { return Properties(mStore->mProperties[mRow] & PropertyMask); }
+
+    /**
+     * get the color of the product
+     * @return the color property
+     */
+    Properties GetColor() const { return Properties((mStore->mProperties[mRow] >> PropertyBits) & PropertyMask); }
+
+    /**
+     * get the content of the product
+     * @return the content property
+     */
+    Properties GetContent() const { return Properties(mStore->mProperties[mRow] >> (2 * PropertyBits)); }
+
+    /**
+     * check if the product should be kicked
+     * @return true if the product should be kicked
+     */
+    bool ShouldKick() const { return (mStore->mFlags[mRow] & ProductStore::Kick) != 0; }
+
+    /**
+     * getter for x location
+     * @return x location
+     */
+    double GetX() const { return mStore->mX[mRow]; }
+
+    /**
+     * getter for y location
+     * @return y location
+     */
+    double GetY() const { return mStore->mY[mRow]; }
+
+    /**
+     * setter for x location
+     * @param x x location
+     */
+    void SetX(double x) { mStore->mX[mRow] = x; }
+
+    /**
+     * setter for y location
+     * @param y y location
+     */
+    void SetY(double y) { mStore->mY[mRow] = y; }
+
+    /**
+     * moves the product down
+     * @param distance the distance to move the product
+     */
+    void MoveDown(double distance) { mStore->mY[mRow] += distance; }
+
+    /**
+     * get the width of the product
+     * @return width in pixels
+     */
+    double GetWidth() const { return mWidth; }
+
+    /**
+     * check if the product is on a conveyor
+     * @param conveyor the conveyor to check
+     * @return true if the product is on the conveyor
+     */
+    bool IsOnConveyor(const ConveyorModel* conveyor) const { return mConveyor == conveyor; }
+
+    /**
+     * check if the product has passed the beam
+     * @return true if the product has passed the beam
+     */
+    bool GetPassedBeam() const { return (mStore->mFlags[mRow] & ProductStore::PassedBeam) != 0; }
+
+    void SetPassedBeam(bool passed);
+
+    /**
+     * get the store holding the moving state of the product
+     * @return the store
+     */
+    const ProductStore& GetStore() const { return *mStore; }
+
+    /**
+     * get the row of the product in its store
+     * @return the row
+     */
+    uint32_t GetRow() const { return mRow; }
+
+    /// Bits of the packed properties used by each of shape, color and content
+    static const int PropertyBits = 4;
+
+    /// Mask of one property in the packed properties
+    static const uint16_t PropertyMask = (1 << PropertyBits) - 1;
+
+private:
+    /// the store moves rows, and updates mRow when it does
+    friend class ProductStore;
+
+    int mPlacement = 0; ///< Placement on conveyor
+    double mWidth = ProductDefaultSize; ///< Width in pixels
+    ConveyorModel* mConveyor = nullptr; ///< The conveyor the product is on
+
+    std::shared_ptr<ProductStore> mStore; ///< store holding the moving state
+    uint32_t mRow = 0; ///< row of this product in mStore
+};
+
+#endif //PRODUCTMODEL_H
@@ -0,0 +1,216 @@
+/**
+ * @file ProductStore.cpp
+ * @author Yeji Lee
+ */
+
+#include "ProductStore.h"
+#include "ProductModel.h"
+#include <algorithm>
+
+/**
+ * add a product, starting at the origin and not moving
+ *
+ * @param properties shape, color and content packed four bits each
+ * @param flags initial Flags
+ * @param owner the product viewing the row, told when the row moves
+ * @return the new row
+ */
+uint32_t ProductStore::Add(uint16_t properties, uint8_t flags, ProductModel* owner)
+{
+    auto row = uint32_t(mX.size());
+    mX.push_back(0);
+    mY.push_back(0);
+    mVelocityX.push_back(0);
+    mBelt.push_back(0);
+    mInitialX.push_back(0);
+    mInitialY.push_back(0);
+    mFlags.push_back(flags);
+    mProperties.push_back(properties);
+    mOwners.push_back(owner);
+    UpdateBelt(row);
+    return row;
+}
+
+/**
+ * add a copy of a row of another store
+ *
+ * Used when a product moves to a conveyor. A pending end of level
+ * countdown is not carried over.
+ *
+ * @param from the store the row is in
+ * @param row the row
+ * @return the new row in this store
+ */
+uint32_t ProductStore::CopyRow(const ProductStore& from, uint32_t row)
+{
+    auto copy = Add(from.mProperties[row], from.mFlags[row], from.mOwners[row]);
+    mX[copy] = from.mX[row];
+    mY[copy] = from.mY[row];
+    mVelocityX[copy] = from.mVelocityX[row];
+    mInitialX[copy] = from.mInitialX[row];
+    mInitialY[copy] = from.mInitialY[row];
+    if (mFlags[copy] & Last)
+    {
+        mLastRows.push_back(copy);
+        mLastDelay.push_back(0);
+    }
+    return copy;
+}
+
+/**
+ * remove a row once its product is gone
+ *
+ * The last row moves into its place and its product is given the new
+ * index.
+ *
+ * @param row the row
+ */
+void ProductStore::Remove(uint32_t row)
+{
+    SetLast(row, false);
+
+    auto last = uint32_t(mX.size() - 1);
+    if (row != last)
+    {
+        mX[row] = mX[last];
+        mY[row] = mY[last];
+        mVelocityX[row] = mVelocityX[last];
+        mBelt[row] = mBelt[last];
+        mInitialX[row] = mInitialX[last];
+        mInitialY[row] = mInitialY[last];
+        mFlags[row] = mFlags[last];
+        mProperties[row] = mProperties[last];
+        mOwners[row] = mOwners[last];
+        mOwners[row]->mRow = row;
+        std::replace(mLastRows.begin(), mLastRows.end(), last, row);
+    }
+
+    mX.pop_back();
+    mY.pop_back();
+    mVelocityX.pop_back();
+    mBelt.pop_back();
+    mInitialX.pop_back();
+    mInitialY.pop_back();
+    mFlags.pop_back();
+    mProperties.pop_back();
+    mOwners.pop_back();
+}
+
+/**
+ * mark a row as the last product on its conveyor, or not
+ *
+ * @param row the row
+ * @param isLast true if this is the last product
+ */
+void ProductStore::SetLast(uint32_t row, bool isLast)
+{
+    auto found = std::find(mLastRows.begin(), mLastRows.end(), row);
+    if (isLast && found == mLastRows.end())
+    {
+        mFlags[row] |= Last;
+        mLastRows.push_back(row);
+        mLastDelay.push_back(0);
+    }
+    else if (!isLast && found != mLastRows.end())
+    {
+        mFlags[row] &= ~Last;
+        mLastDelay.erase(mLastDelay.begin() + (found - mLastRows.begin()));
+        mLastRows.erase(found);
+    }
+}
+
+/**
+ * start the end of level countdown of a row flagged Last
+ *
+ * @param row the row
+ * @param delay the countdown in seconds
+ */
+void ProductStore::StartLastDelay(uint32_t row, double delay)
+{
+    auto found = std::find(mLastRows.begin(), mLastRows.end(), row);
+    if (found != mLastRows.end())
+    {
+        mLastDelay[found - mLastRows.begin()] = delay;
+    }
+}
+
+/**
+ * recompute whether a row rides the belt from its flags
+ *
+ * @param row the row
+ */
+void ProductStore::UpdateBelt(uint32_t row)
+{
+    mBelt[row] = (mFlags[row] & OnConveyor) != 0 ? 1 : 0;
+}
+
+/**
+ * advance every product by one step of the simulation
+ *
+ * @param elapsed the time since the last update
+ * @param beltSpeed speed of the belt, 0 if it is stopped
+ * @return true if the end of level countdown ran out during this update
+ */
+bool ProductStore::Update(double elapsed, double beltSpeed)
+{
+    Move(elapsed, beltSpeed);
+    return UpdateLastDelays(elapsed);
+}
+
+/**
+ * move every product by its kick velocity and the belt
+ *
+ * A product that is not kicked has a velocity of 0 and one off the
+ * belt a belt factor of 0, so every row does the same arithmetic.
+ *
+ * @param elapsed the time since the last update
+ * @param beltSpeed speed of the belt, 0 if it is stopped
+ */
+void ProductStore::Move(double elapsed, double beltSpeed)
+{
+    const size_t count = mX.size();
+    double* x = mX.data();
+    double* y = mY.data();
+    const double* velocityX = mVelocityX.data();
+    const double* belt = mBelt.data();
+    const double dy = beltSpeed * elapsed;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        x[i] -= velocityX[i] * elapsed;
+        y[i] += belt[i] * dy;
+    }
+}
+
+/**
+ * count down the delays started when a last product passes the beam
+ *
+ * @param elapsed the time since the last update
+ * @return true if a delay ran out during this update
+ */
+bool ProductStore::UpdateLastDelays(double elapsed)
+{
+    bool expired = false;
+    for (auto& delay : mLastDelay)
+    {
+        if (delay > 0)
+        {
+            delay -= elapsed;
+            if (delay <= 0)
+            {
+                delay = 0;
+                expired = true;
+            }
+        }
+    }
+    return expired;
+}
+
+/**
+ * put every product back at its initial location
+ */
+void ProductStore::Reset()
+{
+    std::copy(mInitialX.begin(), mInitialX.end(), mX.begin());
+    std::copy(mInitialY.begin(), mInitialY.end(), mY.begin());
+}
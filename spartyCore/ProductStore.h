@@ -0,0 +1,94 @@
+/**
+ * @file ProductStore.h
+ * @author Yeji Lee
+ *
+ * Simulation state of the products on one conveyor, stored by field.
+ */
+
+#ifndef PRODUCTSTORE_H
+#define PRODUCTSTORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class ProductModel;
+
+/**
+ * the moving state of many products, one array per field
+ *
+ * Each product is a row: the same index into every array. Moving all
+ * of them is one loop of plain arithmetic over the position and
+ * velocity arrays, with no branches or calls, which the compiler can
+ * vectorize. ProductModel is a view of one row for everything else.
+ *
+ * A product that leaves, destroyed or moved to another conveyor, has
+ * its row removed by moving the last row into its place, so the loop
+ * only ever covers live products. The product of the moved row is
+ * told its new index, so a row index is only good until the next
+ * Remove.
+ */
+class ProductStore
+{
+public:
+    /// bits of a row's flags
+    enum Flags : uint8_t
+    {
+        Kick = 1, ///< the product should be kicked
+        OnConveyor = 2, ///< the product rides the belt
+        PassedBeam = 4, ///< the product has crossed a beam
+        Last = 8 ///< the product is the last one on its conveyor
+    };
+
+private:
+    friend class ProductModel;
+
+    std::vector<double> mX; ///< x location of each product
+    std::vector<double> mY; ///< y location of each product
+    std::vector<double> mVelocityX; ///< kick speed, or 0 if not kicked
+    std::vector<double> mBelt; ///< 1 if the product rides the belt, else 0
+    std::vector<double> mInitialX; ///< x location to reset to
+    std::vector<double> mInitialY; ///< y location to reset to
+    std::vector<uint8_t> mFlags; ///< Flags of each product
+    std::vector<uint16_t> mProperties; ///< shape, color and content, four bits each
+    std::vector<ProductModel*> mOwners; ///< product viewing each row
+
+    std::vector<uint32_t> mLastRows; ///< rows flagged Last
+    std::vector<double> mLastDelay; ///< countdown of each entry of mLastRows
+
+    void UpdateBelt(uint32_t row);
+
+public:
+    uint32_t Add(uint16_t properties, uint8_t flags, ProductModel* owner);
+    uint32_t CopyRow(const ProductStore& from, uint32_t row);
+    void Remove(uint32_t row);
+    void SetLast(uint32_t row, bool isLast);
+    void StartLastDelay(uint32_t row, double delay);
+
+    bool Update(double elapsed, double beltSpeed);
+    void Move(double elapsed, double beltSpeed);
+    bool UpdateLastDelays(double elapsed);
+    void Reset();
+
+    /**
+     * @return number of rows, one per product
+     */
+    size_t size() const { return mX.size(); }
+
+    /**
+     * @return x locations, size() long
+     */
+    const double* GetX() const { return mX.data(); }
+
+    /**
+     * @return y locations, size() long
+     */
+    const double* GetY() const { return mY.data(); }
+
+    /**
+     * @return Flags of each row, size() long
+     */
+    const uint8_t* GetFlags() const { return mFlags.data(); }
+};
+
+#endif //PRODUCTSTORE_H
@@ -0,0 +1,104 @@
+/**
+ * @file ScenarioBatch.cpp
+ * @author Yeji Lee
+ */
+
+#include "ScenarioBatch.h"
+#include "LogicPlanes.h"
+#include <algorithm>
+
+/// Products in one word of a mask
+const size_t WordBits = 64;
+
+/**
+ * run the circuit once for each product
+ *
+ * @param circuit the compiled circuit
+ * @param products the products, scenario i is products[i]
+ * @param outputs the nets to read the decision from, one per Sparty
+ * @return bit i set if any output was One for product i
+ */
+std::vector<uint64_t> ScenarioBatch::Evaluate(const Circuit& circuit, const std::vector<ProductModel*>& products,
+                                              const std::vector<uint32_t>& outputs) const
+{
+    LogicPlanes planes(circuit.GetNetCount(), products.size());
+    for (uint32_t net = 0; net < circuit.GetNetCount(); net++)
+    {
+        planes.FillNet(net, circuit.GetNet(net));
+    }
+
+    for (const auto& sensor : mSensorNets)
+    {
+        auto mask = PropertyMask(products, sensor.second);
+        std::fill_n(planes.Known(sensor.first), planes.GetWords(), ~uint64_t(0));
+        std::copy(mask.begin(), mask.end(), planes.Value(sensor.first));
+    }
+
+    // a broken beam outputs Zero
+    for (auto net : mBeamNets)
+    {
+        planes.FillNet(net, States::Zero);
+    }
+
+    circuit.EvaluatePlanes(planes);
+
+    // only a known One kicks
+    std::vector<uint64_t> kicks(planes.GetWords(), 0);
+    for (auto output : outputs)
+    {
+        const uint64_t* known = planes.Known(output);
+        const uint64_t* value = planes.Value(output);
+        for (size_t i = 0; i < kicks.size(); i++)
+        {
+            kicks[i] |= known[i] & value[i];
+        }
+    }
+
+    // the scenarios past the last product in its word
+    if (products.size() % WordBits != 0)
+    {
+        kicks.back() &= (uint64_t(1) << (products.size() % WordBits)) - 1;
+    }
+    return kicks;
+}
+
+/**
+ * products that have a property
+ *
+ * @param products the products
+ * @param property the property to look for
+ * @return bit i set if products[i] has the property as shape, color or content
+ */
+std::vector<uint64_t> ScenarioBatch::PropertyMask(const std::vector<ProductModel*>& products,
+                                                  ProductModel::Properties property)
+{
+    std::vector<uint64_t> mask((products.size() + WordBits - 1) / WordBits, 0);
+    for (size_t i = 0; i < products.size(); i++)
+    {
+        auto product = products[i];
+        if (product->GetShape() == property || product->GetColor() == property || product->GetContent() == property)
+        {
+            mask[i / WordBits] |= uint64_t(1) << (i % WordBits);
+        }
+    }
+    return mask;
+}
+
+/**
+ * products that are supposed to be kicked
+ *
+ * @param products the products
+ * @return bit i set if products[i] should be kicked off the conveyor
+ */
+std::vector<uint64_t> ScenarioBatch::KickMask(const std::vector<ProductModel*>& products)
+{
+    std::vector<uint64_t> mask((products.size() + WordBits - 1) / WordBits, 0);
+    for (size_t i = 0; i < products.size(); i++)
+    {
+        if (products[i]->ShouldKick())
+        {
+            mask[i / WordBits] |= uint64_t(1) << (i % WordBits);
+        }
+    }
+    return mask;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file ScenarioBatch.h
+ * @author Yeji Lee
+ *
+ * Runs a compiled circuit for every product of a level at once.
+ */
+
+#ifndef SCENARIOBATCH_H
+#define SCENARIOBATCH_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Circuit.h"
+#include "ProductModel.h"
+
+/**
+ * evaluates what a circuit decides for a batch of products
+ *
+ * Each product is one scenario of Circuit::EvaluatePlanes. The sensor
+ * nets of a scenario are One for the properties its product has and
+ * Zero for the rest, and the beam nets read as broken, the moment the
+ * kick is decided. Every other net starts from its state in the
+ * circuit. One pass then gives the circuit's output for every product.
+ *
+ * Results are masks of 64 bit words, bit i % 64 of word i / 64 for
+ * product i. A product is kicked if any of the outputs is One for it,
+ * since every Sparty kicks when a beam breaks. An output that is
+ * Unknown, such as a gate with an unconnected input, reads as no
+ * kick, as it does in the game.
+ */
+class ScenarioBatch
+{
+private:
+    /// sensor nets and the product property each one sees
+    std::vector<std::pair<uint32_t, ProductModel::Properties>> mSensorNets;
+
+    /// nets driven by beams
+    std::vector<uint32_t> mBeamNets;
+
+public:
+    /**
+     * tell the batch a net is a sensor output
+     * @param net the net
+     * @param property the property that sets it
+     */
+    void AddSensorNet(uint32_t net, ProductModel::Properties property) { mSensorNets.emplace_back(net, property); }
+
+    /**
+     * tell the batch a net is a beam output
+     * @param net the net
+     */
+    void AddBeamNet(uint32_t net) { mBeamNets.push_back(net); }
+
+    /**
+     * forget every sensor and beam net, for when the circuit is rebuilt
+     */
+    void Clear()
+    {
+        mSensorNets.clear();
+        mBeamNets.clear();
+    }
+
+    std::vector<uint64_t> Evaluate(const Circuit& circuit, const std::vector<ProductModel*>& products,
+                                   const std::vector<uint32_t>& outputs) const;
+
+    static std::vector<uint64_t> PropertyMask(const std::vector<ProductModel*>& products,
+                                              ProductModel::Properties property);
+    static std::vector<uint64_t> KickMask(const std::vector<ProductModel*>& products);
+};
+
+#endif //SCENARIOBATCH_H
@@ -0,0 +1,223 @@
+/**
+ * @file Simulation.cpp
+ * @author Yeji Lee
+ */
+
+#include "Simulation.h"
+#include <algorithm>
+
+/**
+ * top edge of a product on the conveyor
+ * @param product the product
+ * @return smallest y covered by the product
+ */
+static double ProductTop(const ProductModel* product)
+{
+    return product->GetY() - product->GetWidth() / 2;
+}
+
+/**
+ * bottom edge of a product on the conveyor
+ * @param product the product
+ * @return largest y covered by the product
+ */
+static double ProductBottom(const ProductModel* product)
+{
+    return product->GetY() + product->GetWidth() / 2;
+}
+
+/**
+ * add a conveyor to the simulation
+ * @param conveyor the conveyor
+ */
+void Simulation::AddConveyor(std::shared_ptr<ConveyorModel> conveyor)
+{
+    mConveyors.push_back(conveyor);
+}
+
+/**
+ * add a product to the simulation
+ * @param product the product
+ */
+void Simulation::AddProduct(std::shared_ptr<ProductModel> product)
+{
+    mProducts.push_back(product);
+    mProductOrder.push_back(product.get());
+}
+
+/**
+ * add a beam to the simulation
+ * @param beam the beam
+ */
+void Simulation::AddBeam(std::shared_ptr<BeamModel> beam)
+{
+    mBeams.push_back(beam);
+
+    auto position = std::upper_bound(mBeamOrder.begin(), mBeamOrder.end(), beam.get(),
+                                     [](const BeamModel* a, const BeamModel* b) { return a->GetY() < b->GetY(); });
+    mBeamOrder.insert(position, beam.get());
+}
+
+/**
+ * add a sparty to the simulation
+ * @param sparty the sparty
+ */
+void Simulation::AddSparty(std::shared_ptr<SpartyModel> sparty)
+{
+    mSpartys.push_back(sparty);
+}
+
+/**
+ * remove everything from the simulation
+ */
+void Simulation::Clear()
+{
+    mConveyors.clear();
+    mProducts.clear();
+    mBeams.clear();
+    mSpartys.clear();
+    mBeamOrder.clear();
+    mProductOrder.clear();
+    mActive.clear();
+    mLevelComplete = false;
+}
+
+/**
+ * advance the whole level by one step
+ *
+ * This is the same sequence Game::Update runs through its items.
+ *
+ * @param elapsed time since the last update in seconds
+ */
+void Simulation::Update(double elapsed)
+{
+    for (const auto& conveyor : mConveyors)
+    {
+        if (conveyor->Update(elapsed))
+        {
+            mLevelComplete = true;
+        }
+    }
+
+    // only products on no conveyor move themselves
+    for (const auto& product : mProducts)
+    {
+        if (product->Update(elapsed))
+        {
+            mLevelComplete = true;
+        }
+    }
+
+    UpdateBeams();
+
+    if (AnyBeamBroken())
+    {
+        KickAll();
+    }
+}
+
+/**
+ * find which products cross which beams, in one pass for the whole level
+ *
+ * Sweep and prune along y: products are kept sorted by their top edge
+ * and the beams by their y. Walking the beams downward, a product joins
+ * the active list once its top reaches the beam and leaves it for good
+ * once its bottom is above a beam, since every later beam is lower
+ * still. Only the active products are tested against each beam.
+ *
+ * Every beam publishes the products it intersects, and those products
+ * are marked as having passed a beam.
+ */
+void Simulation::UpdateBeams()
+{
+    // The products all ride the conveyors at the same speed, so the order
+    // barely changes between steps and insertion sort is close to linear.
+    for (size_t i = 1; i < mProductOrder.size(); i++)
+    {
+        auto product = mProductOrder[i];
+        double top = ProductTop(product);
+        size_t j = i;
+        while (j > 0 && ProductTop(mProductOrder[j - 1]) > top)
+        {
+            mProductOrder[j] = mProductOrder[j - 1];
+            j--;
+        }
+        mProductOrder[j] = product;
+    }
+
+    mActive.clear();
+    size_t next = 0;
+    for (auto beam : mBeamOrder)
+    {
+        double low = beam->GetY() - BeamPadding;
+        double high = beam->GetY() + BeamPadding;
+
+        while (next < mProductOrder.size() && ProductTop(mProductOrder[next]) <= high)
+        {
+            mActive.push_back(mProductOrder[next++]);
+        }
+
+        mActive.erase(std::remove_if(mActive.begin(), mActive.end(),
+                                     [low](const ProductModel* product) { return ProductBottom(product) < low; }),
+                      mActive.end());
+
+        beam->ClearIntersecting();
+        for (auto product : mActive)
+        {
+            if (beam->IsIntersecting(*product))
+            {
+                beam->AddIntersecting(product);
+                product->SetPassedBeam(true);
+                product->HasPassedBeam();
+            }
+        }
+
+        beam->UpdateBroken();
+    }
+}
+
+/**
+ * check if any beam currently sees a product
+ * @return true if at least one beam is broken
+ */
+bool Simulation::AnyBeamBroken() const
+{
+    for (const auto& beam : mBeams)
+    {
+        if (beam->IsBroken())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * make every sparty kick
+ */
+void Simulation::KickAll()
+{
+    for (const auto& sparty : mSpartys)
+    {
+        sparty->Kick();
+    }
+}
+
+/**
+ * start a conveyor and put its products back at their start locations
+ * @param conveyor the conveyor to start
+ */
+void Simulation::StartConveyor(ConveyorModel* conveyor)
+{
+    conveyor->Start();
+    ResetProducts(conveyor);
+}
+
+/**
+ * reset the products on a conveyor to their initial locations
+ * @param conveyor the conveyor whose products are reset
+ */
+void Simulation::ResetProducts(const ConveyorModel* conveyor)
+{
+    conveyor->GetProducts()->Reset();
+}
@@ -0,0 +1,88 @@
+/**
+ * @file Simulation.h
+ * @author Yeji Lee
+ *
+ * Headless simulation of one level: conveyors, products, beams and Sparty.
+ */
+
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <memory>
+#include <vector>
+#include "ProductModel.h"
+#include "ConveyorModel.h"
+#include "BeamModel.h"
+#include "SpartyModel.h"
+
+/**
+ * Holds the simulation state of a level and advances it.
+ *
+ * Game keeps one of these alongside its drawable items, each item
+ * sharing its model with the simulation. Without a Game it can be
+ * filled directly and stepped with Update, with no display at all.
+ */
+class Simulation
+{
+private:
+    /// conveyors in the level
+    std::vector<std::shared_ptr<ConveyorModel>> mConveyors;
+    /// products on the conveyors
+    std::vector<std::shared_ptr<ProductModel>> mProducts;
+    /// beams detecting products
+    std::vector<std::shared_ptr<BeamModel>> mBeams;
+    /// spartys kicking products
+    std::vector<std::shared_ptr<SpartyModel>> mSpartys;
+
+    /// beams sorted by y, kept sorted as beams are added
+    std::vector<BeamModel*> mBeamOrder;
+    /// products sorted by top edge, re-sorted every UpdateBeams
+    std::vector<ProductModel*> mProductOrder;
+    /// products overlapping the current beam during the sweep
+    std::vector<ProductModel*> mActive;
+
+    /// has the last product cleared the beam long enough to end the level
+    bool mLevelComplete = false;
+
+public:
+    void AddConveyor(std::shared_ptr<ConveyorModel> conveyor);
+    void AddProduct(std::shared_ptr<ProductModel> product);
+    void AddBeam(std::shared_ptr<BeamModel> beam);
+    void AddSparty(std::shared_ptr<SpartyModel> sparty);
+    void Clear();
+
+    void Update(double elapsed);
+    void UpdateBeams();
+    bool AnyBeamBroken() const;
+    void KickAll();
+
+    void StartConveyor(ConveyorModel* conveyor);
+    void ResetProducts(const ConveyorModel* conveyor);
+
+    /**
+     * @return the conveyors in the simulation
+     */
+    const std::vector<std::shared_ptr<ConveyorModel>>& GetConveyors() const { return mConveyors; }
+
+    /**
+     * @return the products in the simulation
+     */
+    const std::vector<std::shared_ptr<ProductModel>>& GetProducts() const { return mProducts; }
+
+    /**
+     * @return the beams in the simulation
+     */
+    const std::vector<std::shared_ptr<BeamModel>>& GetBeams() const { return mBeams; }
+
+    /**
+     * @return the spartys in the simulation
+     */
+    const std::vector<std::shared_ptr<SpartyModel>>& GetSpartys() const { return mSpartys; }
+
+    /**
+     * @return true once the level has finished
+     */
+    bool IsLevelComplete() const { return mLevelComplete; }
+};
+
+#endif //SIMULATION_H
@@ -0,0 +1,264 @@
+/**
+ * @file SlotMap.h
+ * @author Yeji Lee
+ *
+ * Pool of objects addressed by generational 32 bit handles.
+ */
+
+#ifndef SLOTMAP_H
+#define SLOTMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * A 32 bit handle to an object in a SlotMap of T.
+ *
+ * The low IndexBits bits are the slot, which stays the same for the
+ * life of the object and can index side tables such as a Netlist.
+ * The high bits are the generation of the slot when the handle was
+ * made. Removing an object bumps its slot's generation, so old
+ * handles to it stop resolving instead of reaching whatever reuses
+ * the slot.
+ */
+template <class T>
+class SlotHandle
+{
+public:
+    /// Bits of the handle used for the slot
+    static constexpr int IndexBits = 20;
+    /// Mask of the slot bits
+    static constexpr uint32_t IndexMask = (uint32_t(1) << IndexBits) - 1;
+    /// Value of a handle to nothing
+    static constexpr uint32_t Invalid = UINT32_MAX;
+
+private:
+    uint32_t mValue = Invalid; ///< generation and slot
+
+public:
+    /// a handle to nothing
+    SlotHandle() = default;
+
+    /**
+     * make a handle
+     * @param slot the slot
+     * @param generation the slot's generation
+     */
+    SlotHandle(uint32_t slot, uint32_t generation) : mValue((generation << IndexBits) | (slot & IndexMask)) {}
+
+    /**
+     * @return the slot, meaningless for a handle to nothing
+     */
+    uint32_t GetSlot() const { return mValue & IndexMask; }
+
+    /**
+     * @return the generation of the slot when the handle was made
+     */
+    uint32_t GetGeneration() const { return mValue >> IndexBits; }
+
+    /**
+     * @return false for a handle to nothing
+     */
+    bool IsSet() const { return mValue != Invalid; }
+
+    /**
+     * @param other another handle
+     * @return true if both handles are the same
+     */
+    bool operator==(const SlotHandle& other) const { return mValue == other.mValue; }
+
+    /**
+     * @param other another handle
+     * @return true if the handles differ
+     */
+    bool operator!=(const SlotHandle& other) const { return mValue != other.mValue; }
+};
+
+/**
+ * Objects stored densely, addressed by SlotHandle.
+ *
+ * The objects sit packed together in one vector so walking all of
+ * them is a linear scan. Each slot records where its object is in that
+ * vector, and removal moves the last object into the hole. Lookup by
+ * handle is two array reads and a generation check.
+ *
+ * Objects move when others are added or removed, so pointers from Get
+ * are only good until the next Add or Remove; keep the handle instead.
+ */
+template <class T>
+class SlotMap
+{
+public:
+    /// Handle to an object in this map
+    typedef SlotHandle<T> Handle;
+
+private:
+    /// bookkeeping for one slot
+    struct Slot
+    {
+        uint32_t mDense = 0; ///< index in mValues, or the next free slot if free
+        uint32_t mGeneration = 0; ///< bumped each time the slot is freed
+        bool mUsed = false; ///< does the slot hold an object
+    };
+
+    /// Mask of the generation bits of a handle
+    static constexpr uint32_t GenerationMask = UINT32_MAX >> Handle::IndexBits;
+
+    /// None, at the end of the free list
+    static constexpr uint32_t NoSlot = UINT32_MAX;
+
+    std::vector<Slot> mSlots; ///< every slot ever used
+    std::vector<T> mValues; ///< the objects, packed
+    std::vector<uint32_t> mValueSlots; ///< slot of each object in mValues
+    uint32_t mFree = NoSlot; ///< first free slot
+
+public:
+    /**
+     * add an object
+     * @param args arguments for the object's constructor
+     * @return handle to the new object
+     */
+    template <class... Args>
+    Handle Add(Args&&... args)
+    {
+        uint32_t slot;
+        if (mFree != NoSlot)
+        {
+            slot = mFree;
+            mFree = mSlots[slot].mDense;
+        }
+        else
+        {
+            slot = uint32_t(mSlots.size());
+            mSlots.emplace_back();
+        }
+
+        mSlots[slot].mDense = uint32_t(mValues.size());
+        mSlots[slot].mUsed = true;
+        mValues.emplace_back(std::forward<Args>(args)...);
+        mValueSlots.push_back(slot);
+        return Handle(slot, mSlots[slot].mGeneration);
+    }
+
+    /**
+     * remove an object, stale handles are ignored
+     * @param handle handle to the object
+     * @return true if an object was removed
+     */
+    bool Remove(Handle handle)
+    {
+        if (!IsValid(handle))
+        {
+            return false;
+        }
+
+        auto slot = handle.GetSlot();
+        auto dense = mSlots[slot].mDense;
+        auto last = uint32_t(mValues.size() - 1);
+        if (dense != last)
+        {
+            mValues[dense] = std::move(mValues[last]);
+            mValueSlots[dense] = mValueSlots[last];
+            mSlots[mValueSlots[dense]].mDense = dense;
+        }
+        mValues.pop_back();
+        mValueSlots.pop_back();
+
+        mSlots[slot].mUsed = false;
+        mSlots[slot].mGeneration = (mSlots[slot].mGeneration + 1) & GenerationMask;
+        mSlots[slot].mDense = mFree;
+        mFree = slot;
+        return true;
+    }
+
+    /**
+     * remove every object, invalidating every handle
+     */
+    void Clear()
+    {
+        mValues.clear();
+        mValueSlots.clear();
+        mFree = NoSlot;
+        for (uint32_t slot = uint32_t(mSlots.size()); slot-- > 0;)
+        {
+            if (mSlots[slot].mUsed)
+            {
+                mSlots[slot].mGeneration = (mSlots[slot].mGeneration + 1) & GenerationMask;
+            }
+            mSlots[slot].mUsed = false;
+            mSlots[slot].mDense = mFree;
+            mFree = slot;
+        }
+    }
+
+    /**
+     * @param handle a handle
+     * @return true if the handle refers to an object in the map
+     */
+    bool IsValid(Handle handle) const
+    {
+        auto slot = handle.GetSlot();
+        return handle.IsSet() && slot < mSlots.size() && mSlots[slot].mUsed &&
+               mSlots[slot].mGeneration == handle.GetGeneration();
+    }
+
+    /**
+     * look up an object
+     * @param handle handle to the object
+     * @return the object, nullptr if the handle is stale
+     */
+    T* Get(Handle handle) { return IsValid(handle) ? &mValues[mSlots[handle.GetSlot()].mDense] : nullptr; }
+
+    /**
+     * look up an object
+     * @param handle handle to the object
+     * @return the object, nullptr if the handle is stale
+     */
+    const T* Get(Handle handle) const { return IsValid(handle) ? &mValues[mSlots[handle.GetSlot()].mDense] : nullptr; }
+
+    /**
+     * look up an object by slot alone, for side tables indexed by slot
+     * @param slot the slot
+     * @return the object, nullptr if the slot is free
+     */
+    T* GetAt(uint32_t slot)
+    {
+        return slot < mSlots.size() && mSlots[slot].mUsed ? &mValues[mSlots[slot].mDense] : nullptr;
+    }
+
+    /**
+     * make a handle from a slot alone, such as an ID from a side table
+     * @param slot the slot
+     * @return handle to the object in the slot, a handle to nothing if the slot is free
+     */
+    Handle GetHandleAt(uint32_t slot) const
+    {
+        return slot < mSlots.size() && mSlots[slot].mUsed ? Handle(slot, mSlots[slot].mGeneration) : Handle();
+    }
+
+    /**
+     * @return number of slots, one more than the highest slot in use
+     */
+    size_t GetSlotCount() const { return mSlots.size(); }
+
+    /**
+     * @return number of objects
+     */
+    size_t size() const { return mValues.size(); }
+
+    /// @return first object, in no particular order
+    typename std::vector<T>::iterator begin() { return mValues.begin(); }
+
+    /// @return one past the last object
+    typename std::vector<T>::iterator end() { return mValues.end(); }
+
+    /// @return first object, in no particular order
+    typename std::vector<T>::const_iterator begin() const { return mValues.begin(); }
+
+    /// @return one past the last object
+    typename std::vector<T>::const_iterator end() const { return mValues.end(); }
+};
+
+#endif //SLOTMAP_H
@@ -0,0 +1,35 @@
+/**
+ * @file SpartyModel.cpp
+ * @author Yeji Lee
+ */
+
+#include "SpartyModel.h"
+#include <cmath>
+
+/**
+ * constructor
+ *
+ * @param x coordinate of sparty position
+ * @param y coordinate of sparty position
+ * @param height height of sparty
+ * @param pinX x location of the input pin
+ * @param pinY y location of the input pin
+ * @param kickDuration duration of the kick action in seconds
+ * @param kickSpeed speed of the kick action in pixels per second
+ */
+SpartyModel::SpartyModel(int x, int y, int height, double pinX, double pinY, double kickDuration, double kickSpeed)
+    : mX(x), mY(y), mHeight(height), mPinX(pinX), mPinY(pinY),
+      mKickDuration(kickDuration), mKickSpeed(kickSpeed)
+{
+    // Calculate width to maintain aspect ratio
+    mWidth = (int)std::round(mHeight * AspectRatio);
+}
+
+/**
+ * start a kick
+ */
+void SpartyModel::Kick()
+{
+    mIsKicking = true;
+    mKickProgress = 0.0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file SpartyModel.h
+ * @author Yeji Lee
+ *
+ * Simulation state of Sparty, the character that kicks products.
+ */
+
+#ifndef SPARTYMODEL_H
+#define SPARTYMODEL_H
+
+/**
+ * wxWidgets-free state of Sparty: geometry, input pin location and kick state
+ */
+class SpartyModel
+{
+private:
+    int mX; ///< x position
+    int mY; ///< y position
+    int mHeight; ///< height of sparty
+    int mWidth; ///< width of sparty
+    double mPinX; ///< x location of input pin
+    double mPinY; ///< y location of input pin
+    double mKickDuration; ///< Duration of kick animation in seconds
+    double mKickSpeed; ///< Speed of kick in pixels per second
+
+    bool mIsKicking = false; ///< kicking state
+    double mKickProgress = 0.0; ///< progress of the kick animation
+
+public:
+    /// width to height ratio of sparty
+    static constexpr double AspectRatio = 1.2;
+
+    SpartyModel(int x, int y, int height, double pinX, double pinY, double kickDuration, double kickSpeed);
+
+    /// Default constructor (disabled)
+    SpartyModel() = delete;
+
+    /// Copy constructor (disabled)
+    SpartyModel(const SpartyModel&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const SpartyModel&) = delete;
+
+    void Kick();
+
+    /**
+     * sets sparty kicking state
+     * @param kicking boolean value indicating if sparty is kicking
+     */
+    void SetKicking(bool kicking) { mIsKicking = kicking; }
+
+    /**
+     * checks if sparty is currently in the kicking state
+     * @return true if sparty is kicking
+     */
+    bool IsKicking() const { return mIsKicking; }
+
+    /**
+     * @return progress of the kick animation
+     */
+    double GetKickProgress() const { return mKickProgress; }
+
+    /**
+     * @return x position
+     */
+    int GetX() const { return mX; }
+
+    /**
+     * @return y position
+     */
+    int GetY() const { return mY; }
+
+    /**
+     * @return height of sparty
+     */
+    int GetHeight() const { return mHeight; }
+
+    /**
+     * @return width of sparty
+     */
+    int GetWidth() const { return mWidth; }
+
+    /**
+     * @return x location of the input pin
+     */
+    double GetPinX() const { return mPinX; }
+
+    /**
+     * @return y location of the input pin
+     */
+    double GetPinY() const { return mPinY; }
+
+    /**
+     * @return duration of the kick in seconds
+     */
+    double GetKickDuration() const { return mKickDuration; }
+
+    /**
+     * @return speed of the kick in pixels per second
+     */
+    double GetKickSpeed() const { return mKickSpeed; }
+};
+
+#endif //SPARTYMODEL_H
@@ -13,7 +13,7 @@
  * Enumeration class for different states
  * 
  */
-enum class States { One, Zero, Unknown };
+enum class States : unsigned char { One, Zero, Unknown };
 
 
 #endif //STATES_H
@@ -0,0 +1,69 @@
+/**
+ * @file WireCurve.cpp
+ * @author Yeji Lee
+ */
+
+#include "WireCurve.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * set where the wire starts and ends, flattening the curve if they moved
+ *
+ * @param startX X of the output pin
+ * @param startY Y of the output pin
+ * @param endX X of the input pin
+ * @param endY Y of the input pin
+ * @return true if the curve changed
+ */
+bool WireCurve::SetEnds(double startX, double startY, double endX, double endY)
+{
+    if (!mPoints.empty() && startX == mStartX && startY == mStartY && endX == mEndX && endY == mEndY)
+    {
+        return false;
+    }
+
+    mStartX = startX;
+    mStartY = startY;
+    mEndX = endX;
+    mEndY = endY;
+
+    double offset = std::min(MaxControlOffset, std::abs(endX - startX));
+    double x2 = startX + offset;
+    double x3 = endX - offset;
+
+    // the control polygon is at least as long as the curve
+    double length = std::hypot(x2 - startX, 0.0) + std::hypot(x3 - x2, endY - startY) + std::hypot(endX - x3, 0.0);
+    size_t segments = std::clamp(size_t(std::ceil(length / SegmentLength)), size_t(1), MaxSegments);
+
+    mPoints.resize(segments + 1);
+    for (size_t i = 0; i <= segments; i++)
+    {
+        double t = double(i) / segments;
+        double u = 1 - t;
+        double a = u * u * u;
+        double b = 3 * u * u * t;
+        double c = 3 * u * t * t;
+        double d = t * t * t;
+
+        // both control points share a Y with their end
+        mPoints[i] = {a * startX + b * x2 + c * x3 + d * endX, (a + b) * startY + (c + d) * endY};
+    }
+
+    // the curve stays inside the box around its end and control points
+    mBounds = {std::min({startX, endX, x2, x3}), std::min(startY, endY),
+               std::max({startX, endX, x2, x3}), std::max(startY, endY)};
+    return true;
+}
+
+/**
+ * the area the wire is drawn in
+ *
+ * @param lineWidth width of the line it is drawn with
+ * @return the bounds in virtual pixels
+ */
+DamageRegion::Rect WireCurve::GetBounds(double lineWidth) const
+{
+    return {mBounds.mLeft - lineWidth, mBounds.mTop - lineWidth, mBounds.mRight + lineWidth,
+            mBounds.mBottom + lineWidth};
+}
@@ -0,0 +1,64 @@
+/**
+ * @file WireCurve.h
+ * @author Yeji Lee
+ *
+ * The curve of a wire between two pins, flattened into line segments.
+ */
+
+#ifndef WIRECURVE_H
+#define WIRECURVE_H
+
+#include <cstddef>
+#include <vector>
+#include "DamageRegion.h"
+
+/**
+ * a wire's cubic Bezier curve as a polyline
+ *
+ * The curve leaves the output pin and reaches the input pin
+ * horizontally, its control points pulled out by up to
+ * MaxControlOffset. It is flattened into segments of about
+ * SegmentLength when the ends are set, and again only when an end
+ * moves, so drawing a wire costs adding its points to a path.
+ */
+class WireCurve
+{
+public:
+    /**
+     * a point of the polyline
+     */
+    struct Point
+    {
+        double mX = 0; ///< X in virtual pixels
+        double mY = 0; ///< Y in virtual pixels
+    };
+
+    /// Maximum offset of the control points from the ends
+    static constexpr double MaxControlOffset = 200;
+
+    /// Length of the segments the curve is flattened into, in virtual pixels
+    static constexpr double SegmentLength = 8;
+
+    /// Most segments a curve is flattened into
+    static constexpr size_t MaxSegments = 64;
+
+private:
+    double mStartX = 0; ///< X of the output end
+    double mStartY = 0; ///< Y of the output end
+    double mEndX = 0; ///< X of the input end
+    double mEndY = 0; ///< Y of the input end
+    std::vector<Point> mPoints; ///< the polyline, empty until the ends are set
+    DamageRegion::Rect mBounds; ///< box around the curve
+
+public:
+    bool SetEnds(double startX, double startY, double endX, double endY);
+
+    /**
+     * @return the polyline, from the output end to the input end
+     */
+    const std::vector<Point>& GetPoints() const { return mPoints; }
+
+    DamageRegion::Rect GetBounds(double lineWidth) const;
+};
+
+#endif //WIRECURVE_H
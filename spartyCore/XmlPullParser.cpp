@@ -0,0 +1,448 @@
+/**
+ * @file XmlPullParser.cpp
+ * @author Yeji Lee
+ */
+
+#include "XmlPullParser.h"
+#include <cstdint>
+
+/**
+ * is a character whitespace to XML
+ * @param c the character
+ * @return true for space, tab, carriage return and newline
+ */
+static bool IsSpace(int c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+/**
+ * can a character be part of a name
+ * @param c the character
+ * @return true for letters, digits, the name punctuation and any
+ * byte of a multibyte UTF-8 character
+ */
+static bool IsNameChar(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == ':' ||
+           c == '-' || c == '.' || c >= 0x80;
+}
+
+/**
+ * append a character to a string as UTF-8
+ * @param code the character
+ * @param out the string
+ */
+static void AppendUtf8(uint32_t code, std::string& out)
+{
+    if (code < 0x80)
+    {
+        out += char(code);
+    }
+    else if (code < 0x800)
+    {
+        out += char(0xc0 | (code >> 6));
+        out += char(0x80 | (code & 0x3f));
+    }
+    else if (code < 0x10000)
+    {
+        out += char(0xe0 | (code >> 12));
+        out += char(0x80 | ((code >> 6) & 0x3f));
+        out += char(0x80 | (code & 0x3f));
+    }
+    else
+    {
+        out += char(0xf0 | (code >> 18));
+        out += char(0x80 | ((code >> 12) & 0x3f));
+        out += char(0x80 | ((code >> 6) & 0x3f));
+        out += char(0x80 | (code & 0x3f));
+    }
+}
+
+/**
+ * constructor
+ * @param in the document, read as it is needed
+ */
+XmlPullParser::XmlPullParser(std::istream& in) : mIn(in), mBuffer(BufferSize)
+{
+}
+
+/**
+ * read more of the document into the buffer
+ * @return false at the end of the document
+ */
+bool XmlPullParser::Refill()
+{
+    mIn.read(mBuffer.data(), std::streamsize(mBuffer.size()));
+    mPosition = 0;
+    mEnd = size_t(mIn.gcount());
+    return mEnd > 0;
+}
+
+/**
+ * @return the next character, -1 at the end of the document
+ */
+int XmlPullParser::Peek()
+{
+    if (mPosition == mEnd && !Refill())
+    {
+        return -1;
+    }
+    return (unsigned char)mBuffer[mPosition];
+}
+
+/**
+ * @return the next character, consumed, or -1 at the end of the document
+ */
+int XmlPullParser::Get()
+{
+    int c = Peek();
+    if (c >= 0)
+    {
+        mPosition++;
+    }
+    return c;
+}
+
+/**
+ * consume characters that must come next
+ * @param text the characters
+ * @return false if the document has something else
+ */
+bool XmlPullParser::Match(std::string_view text)
+{
+    for (char c : text)
+    {
+        if (Get() != (unsigned char)c)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * consume everything up to and including a terminator
+ * @param end the terminator
+ * @return false if the document ends first
+ */
+bool XmlPullParser::Skip(std::string_view end)
+{
+    std::string window;
+    for (int c = Get(); c >= 0; c = Get())
+    {
+        window += char(c);
+        if (window.size() > end.size())
+        {
+            window.erase(0, 1);
+        }
+        if (window == end)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * consume whitespace
+ */
+void XmlPullParser::SkipSpace()
+{
+    while (IsSpace(Peek()))
+    {
+        Get();
+    }
+}
+
+/**
+ * read an element or attribute name
+ * @param name set to the name
+ * @return false if there is no name here
+ */
+bool XmlPullParser::ReadName(std::string& name)
+{
+    name.clear();
+    int c = Peek();
+    if (!IsNameChar(c) || c == '-' || c == '.' || (c >= '0' && c <= '9'))
+    {
+        return false;
+    }
+
+    while (IsNameChar(Peek()))
+    {
+        name += char(Get());
+    }
+    return true;
+}
+
+/**
+ * read a character reference, after its &
+ * @param out string the character is appended to
+ * @return false if the reference is not one XML defines
+ */
+bool XmlPullParser::ReadReference(std::string& out)
+{
+    std::string name;
+    for (int c = Get(); c != ';'; c = Get())
+    {
+        if (c < 0 || name.size() > 8)
+        {
+            return false;
+        }
+        name += char(c);
+    }
+
+    if (name == "amp") out += '&';
+    else if (name == "lt") out += '<';
+    else if (name == "gt") out += '>';
+    else if (name == "quot") out += '"';
+    else if (name == "apos") out += '\'';
+    else if (name.size() > 1 && name[0] == '#')
+    {
+        bool hex = name[1] == 'x';
+        uint32_t code = 0;
+        size_t digits = 0;
+        for (size_t i = hex ? 2 : 1; i < name.size(); i++, digits++)
+        {
+            char c = name[i];
+            int digit = c >= '0' && c <= '9' ? c - '0'
+                      : hex && c >= 'a' && c <= 'f' ? c - 'a' + 10
+                      : hex && c >= 'A' && c <= 'F' ? c - 'A' + 10
+                      : -1;
+            if (digit < 0)
+            {
+                return false;
+            }
+            code = code * (hex ? 16 : 10) + uint32_t(digit);
+        }
+        if (digits == 0 || code > 0x10ffff)
+        {
+            return false;
+        }
+        AppendUtf8(code, out);
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * go to the next element, end of element or text
+ * @return what was found
+ */
+XmlPullParser::Event XmlPullParser::Next()
+{
+    if (mEndPending)
+    {
+        mEndPending = false;
+        mDepth--;
+        return Event::EndElement;
+    }
+
+    while (true)
+    {
+        int c = Peek();
+        if (c < 0)
+        {
+            return mDepth == 0 ? Event::EndDocument : Event::Error;
+        }
+
+        if (c != '<')
+        {
+            if (ReadText() == Event::Error)
+            {
+                return Event::Error;
+            }
+
+            // whitespace between tags, and text outside the root element
+            if (mDepth > 0 && mText.find_first_not_of(" \t\r\n") != std::string::npos)
+            {
+                return Event::Text;
+            }
+            continue;
+        }
+
+        Get();
+        c = Peek();
+        if (c == '/')
+        {
+            Get();
+            return EndTag();
+        }
+
+        if (c == '?')
+        {
+            if (!Skip("?>"))
+            {
+                return Event::Error;
+            }
+            continue;
+        }
+
+        if (c == '!')
+        {
+            Get();
+            bool skipped = Peek() == '-' ? Match("--") && Skip("-->")
+                         : Peek() == '[' ? Match("[CDATA[") && Skip("]]>")
+                         : Skip(">");
+            if (!skipped)
+            {
+                return Event::Error;
+            }
+            continue;
+        }
+
+        return StartTag();
+    }
+}
+
+/**
+ * read a start tag, after its <
+ * @return StartElement, or Error if the tag is malformed
+ */
+XmlPullParser::Event XmlPullParser::StartTag()
+{
+    if (!ReadName(mName))
+    {
+        return Event::Error;
+    }
+
+    mAttributeCount = 0;
+    while (true)
+    {
+        SkipSpace();
+        int c = Peek();
+        if (c == '>' || c == '/')
+        {
+            Get();
+            if (c == '/' && Get() != '>')
+            {
+                return Event::Error;
+            }
+            mEndPending = c == '/';
+            if (size_t(mDepth) == mOpen.size())
+            {
+                mOpen.emplace_back();
+            }
+            mOpen[mDepth++] = mName;
+            return Event::StartElement;
+        }
+
+        if (mAttributeCount == mAttributes.size())
+        {
+            mAttributes.emplace_back();
+        }
+        auto& attribute = mAttributes[mAttributeCount++];
+        if (!ReadName(attribute.first))
+        {
+            return Event::Error;
+        }
+
+        SkipSpace();
+        if (Get() != '=')
+        {
+            return Event::Error;
+        }
+        SkipSpace();
+
+        int quote = Get();
+        if (quote != '"' && quote != '\'')
+        {
+            return Event::Error;
+        }
+
+        attribute.second.clear();
+        for (c = Get(); c != quote; c = Get())
+        {
+            if (c < 0 || c == '<')
+            {
+                return Event::Error;
+            }
+            if (c == '&')
+            {
+                if (!ReadReference(attribute.second))
+                {
+                    return Event::Error;
+                }
+            }
+            else
+            {
+                attribute.second += char(c);
+            }
+        }
+    }
+}
+
+/**
+ * read an end tag, after its </
+ * @return EndElement, or Error if the tag is malformed or does not
+ * close the element open
+ */
+XmlPullParser::Event XmlPullParser::EndTag()
+{
+    if (!ReadName(mName) || mDepth == 0 || mName != mOpen[mDepth - 1])
+    {
+        return Event::Error;
+    }
+
+    SkipSpace();
+    if (Get() != '>')
+    {
+        return Event::Error;
+    }
+
+    mDepth--;
+    return Event::EndElement;
+}
+
+/**
+ * read text up to the next tag
+ * @return Text, or Error for a bad character reference
+ */
+XmlPullParser::Event XmlPullParser::ReadText()
+{
+    mText.clear();
+    for (int c = Peek(); c >= 0 && c != '<'; c = Peek())
+    {
+        Get();
+        if (c == '\r')
+        {
+            // line ends read as a single newline, as XML requires
+            if (Peek() == '\n')
+            {
+                continue;
+            }
+            c = '\n';
+        }
+
+        if (c != '&')
+        {
+            mText += char(c);
+        }
+        else if (!ReadReference(mText))
+        {
+            return Event::Error;
+        }
+    }
+    return Event::Text;
+}
+
+/**
+ * look up an attribute of the current element
+ * @param name the attribute name
+ * @return its value, nullptr if the element does not have it
+ */
+const std::string* XmlPullParser::FindAttribute(std::string_view name) const
+{
+    for (size_t i = 0; i < mAttributeCount; i++)
+    {
+        if (mAttributes[i].first == name)
+        {
+            return &mAttributes[i].second;
+        }
+    }
+    return nullptr;
+}
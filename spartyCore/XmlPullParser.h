@@ -0,0 +1,97 @@
+/**
+ * @file XmlPullParser.h
+ * @author Yeji Lee
+ *
+ * Streaming XML reader that hands out one element or text at a time.
+ */
+
+#ifndef XMLPULLPARSER_H
+#define XMLPULLPARSER_H
+
+#include <istream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * reads XML from a stream one event at a time, without building a tree
+ *
+ * Only a fixed size buffer of the input is held at once, plus the
+ * name, attributes or text of the current event, so memory does not
+ * grow with the document. It reads the subset of XML levels use:
+ * elements, attributes, text, the predefined and numeric character
+ * references. Comments, CDATA sections, processing instructions and
+ * the DOCTYPE are skipped. An end tag that does not close the element
+ * open is an Error. Text that is only whitespace is skipped too, as
+ * wxXmlDocument does by default.
+ *
+ * An empty element such as <br/> gives a StartElement immediately
+ * followed by its EndElement.
+ */
+class XmlPullParser
+{
+public:
+    /// what Next found
+    enum class Event { StartElement, EndElement, Text, EndDocument, Error };
+
+    /// Bytes read from the stream at a time
+    static const size_t BufferSize = 64 * 1024;
+
+private:
+    std::istream& mIn; ///< the document
+    std::vector<char> mBuffer; ///< the part of the document read so far and not used
+    size_t mPosition = 0; ///< next character in mBuffer
+    size_t mEnd = 0; ///< end of the valid characters in mBuffer
+
+    std::string mName; ///< name of the current element
+    std::string mText; ///< the current text
+    std::vector<std::pair<std::string, std::string>> mAttributes; ///< attributes, reused between elements
+    size_t mAttributeCount = 0; ///< attributes of the current element
+
+    bool mEndPending = false; ///< the current element was empty, its EndElement is next
+    int mDepth = 0; ///< elements open
+    std::vector<std::string> mOpen; ///< names of the open elements, the first mDepth are used
+
+    int Peek();
+    int Get();
+    bool Refill();
+    bool Skip(std::string_view end);
+    bool Match(std::string_view text);
+    bool ReadName(std::string& name);
+    bool ReadReference(std::string& out);
+    void SkipSpace();
+    Event StartTag();
+    Event EndTag();
+    Event ReadText();
+
+public:
+    explicit XmlPullParser(std::istream& in);
+
+    /// Copy constructor (disabled)
+    XmlPullParser(const XmlPullParser&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const XmlPullParser&) = delete;
+
+    Event Next();
+
+    /**
+     * @return name of the element of a StartElement or EndElement
+     */
+    const std::string& GetName() const { return mName; }
+
+    /**
+     * @return the text of a Text event, with references replaced
+     */
+    const std::string& GetText() const { return mText; }
+
+    /**
+     * @return number of elements open, counting the one just started
+     */
+    int GetDepth() const { return mDepth; }
+
+    const std::string* FindAttribute(std::string_view name) const;
+};
+
+#endif //XMLPULLPARSER_H